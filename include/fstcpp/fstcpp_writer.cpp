@@ -7,10 +7,12 @@
 #include "fstcpp/fstcpp_writer.h"
 // C system headers
 // C++ standard library headers
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -57,6 +59,26 @@ void ValueChangeData::keepOnlyTheLatestValue() {
 	m_timestamps.resize(1);
 }
 
+void ValueChangeData::moveToKeepingTheLatestValue(ValueChangeData &dst) {
+	FST_CHECK(!m_timestamps.empty());
+	dst.m_timestamps.clear();
+	dst.m_timestamps.swap(m_timestamps);
+	m_timestamps.push_back(dst.m_timestamps.back());
+	dst.m_variable_infos.clear();
+	dst.m_variable_infos.swap(m_variable_infos);
+	m_variable_infos.reserve(dst.m_variable_infos.size());
+	for (VariableInfo &v : dst.m_variable_infos) {
+		m_variable_infos.emplace_back(v.bitwidth(), v.is_real());
+		VariableInfo &latest = m_variable_infos.back();
+		const uint64_t last_written_bytes_ = v.last_written_bytes();
+		latest.resize(last_written_bytes_);
+		std::copy_n(
+			v.data_ptr() + v.size() - last_written_bytes_, last_written_bytes_, latest.data_ptr()
+		);
+		latest.last_written_encode_type(v.last_written_encode_type());
+	}
+}
+
 }  // namespace detail
 
 void Writer::open(const string_view_pair name) {
@@ -78,6 +100,7 @@ void Writer::close() {
 		m_header_.m_start_time = 0;
 	}
 	flushValueChangeData_(m_value_change_data_, m_main_fst_file_);
+	waitForFlush_();
 	appendGeometry_(m_main_fst_file_);
 	appendHierarchy_(m_main_fst_file_);
 	appendBlackout_(m_main_fst_file_);
@@ -205,7 +228,7 @@ void Writer::emitTimeChange(uint64_t tim) {
 	finalizeHierarchy_();
 
 	if (m_value_change_data_usage_ > m_value_change_data_flush_threshold_ || m_flush_pending_) {
-		flushValueChangeData_(m_value_change_data_, m_main_fst_file_);
+		flushValueChangeData_(m_value_change_data_, m_main_fst_file_, true);
 	}
 
 	// Update header
@@ -371,6 +394,41 @@ std::pair<const uint8_t *, size_t> selectSmaller(
 	return ret;
 }
 
+// Call func(i) for i in [0, n), using up to parallelism threads including the caller
+template <typename Func>
+void parallelFor(size_t n, unsigned parallelism, Func &&func) {
+	// Variables are claimed in chunks to keep the atomic off the hot path
+	constexpr size_t kChunkSize = 64;
+	const size_t num_chunks{(n + kChunkSize - 1) / kChunkSize};
+	const unsigned num_threads{
+		static_cast<unsigned>(std::min<size_t>(parallelism == 0 ? 1 : parallelism, num_chunks))
+	};
+	if (num_threads <= 1) {
+		for (size_t i{0}; i < n; ++i) {
+			func(i);
+		}
+		return;
+	}
+	std::atomic<size_t> next_chunk{0};
+	const auto worker = [&]() {
+		for (size_t c; (c = next_chunk.fetch_add(1, std::memory_order_relaxed)) < num_chunks;) {
+			const size_t end{std::min(n, (c + 1) * kChunkSize)};
+			for (size_t i{c * kChunkSize}; i < end; ++i) {
+				func(i);
+			}
+		}
+	};
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads - 1);
+	for (unsigned t{1}; t < num_threads; ++t) {
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (std::thread &t : threads) {
+		t.join();
+	}
+}
+
 }  // namespace
 
 // AppendHierarchy_ and AppendGeometry_ shares a very similar structure
@@ -460,12 +518,11 @@ void detail::ValueChangeData::writeInitialBits(std::vector<uint8_t> &os) const {
 	}
 }
 
-std::vector<std::vector<uint8_t>> detail::ValueChangeData::computeWaveData() const {
+std::vector<std::vector<uint8_t>> detail::ValueChangeData::computeWaveData(unsigned parallelism
+) const {
 	const size_t N{m_variable_infos.size()};
 	std::vector<std::vector<uint8_t>> data(N);
-	for (size_t i{0}; i < N; ++i) {
-		m_variable_infos[i].dumpValueChanges(data[i]);
-	}
+	parallelFor(N, parallelism, [&](size_t i) { m_variable_infos[i].dumpValueChanges(data[i]); });
 	return data;
 }
 
@@ -514,7 +571,8 @@ uint64_t detail::ValueChangeData::encodePositionsAndwriteUniqueWaveData(
 	std::ostream &os,
 	const std::vector<std::vector<uint8_t>> &data,
 	std::vector<int64_t> &positions,
-	WriterPackType pack_type
+	WriterPackType pack_type,
+	unsigned parallelism
 ) {
 	// After this function, positions[i] is:
 	//  - = 0: If variable i has no wave data
@@ -522,10 +580,23 @@ uint64_t detail::ValueChangeData::encodePositionsAndwriteUniqueWaveData(
 	//  unchanged
 	//  - > 0: The size (in bytes) of the wave data block for *previous* variable,
 	//         the previous block size of the first block is 1 (required by FST spec).
+	const auto need_compress = [&](size_t i) {
+		return positions[i] >= 0 && pack_type != WriterPackType::NO_COMPRESSION &&
+			   data[i].size() > 32;
+	};
+	// Compression of each variable is independent, so do it up front in parallel,
+	// and then write the results sequentially as the positions depend on the order
+	std::vector<std::vector<uint8_t>> compressed_data(parallelism > 1 ? data.size() : 0);
+	if (parallelism > 1) {
+		parallelFor(data.size(), parallelism, [&](size_t i) {
+			if (need_compress(i)) compressUsingLz4(data[i], compressed_data[i]);
+		});
+	}
+	std::vector<uint8_t> serial_compressed_data;
+
 	StreamWriteHelper h(os);
 	int64_t previous_size = 1;
 	uint64_t written_count = 0;
-	std::vector<uint8_t> compressed_data;
 	for (size_t i = 0; i < positions.size(); ++i) {
 		if (positions[i] < 0) {
 			// duplicate (negative index), do nothing
@@ -535,13 +606,15 @@ uint64_t detail::ValueChangeData::encodePositionsAndwriteUniqueWaveData(
 			// try to compress
 			const uint8_t *selected_data;
 			size_t selected_size;
-			if (pack_type == WriterPackType::NO_COMPRESSION || data[i].size() <= 32) {
+			if (!need_compress(i)) {
 				selected_data = data[i].data();
 				selected_size = data[i].size();
 			} else {
-				compressUsingLz4(data[i], compressed_data);
+				if (parallelism <= 1) compressUsingLz4(data[i], serial_compressed_data);
+				const std::vector<uint8_t> &compressed =
+					parallelism > 1 ? compressed_data[i] : serial_compressed_data;
 				const std::pair<const uint8_t *, size_t> selected_pair =
-					selectSmaller(compressed_data, data[i]);
+					selectSmaller(compressed, data[i]);
 				selected_data = selected_pair.first;
 				selected_size = selected_pair.second;
 			}
@@ -625,7 +698,10 @@ void detail::ValueChangeData::writeTimestamps(std::vector<uint8_t> &os) const {
 }
 
 void Writer::flushValueChangeDataConstPart_(
-	const detail::ValueChangeData &vcd, std::ostream &os, WriterPackType pack_type
+	const detail::ValueChangeData &vcd,
+	std::ostream &os,
+	WriterPackType pack_type,
+	unsigned parallelism
 ) {
 	// 0. setup
 	StreamWriteHelper h(os);
@@ -675,7 +751,7 @@ void Writer::flushValueChangeDataConstPart_(
 	// 3. Waves Section
 	// Note: We need positions for the next section
 	const auto p_tmp2 = [&, pack_type]() {
-		std::vector<std::vector<uint8_t>> wave_data{vcd.computeWaveData()};
+		std::vector<std::vector<uint8_t>> wave_data{vcd.computeWaveData(parallelism)};
 		const size_t memory_usage{std::accumulate(
 			wave_data.begin(),
 			wave_data.end(),
@@ -690,7 +766,7 @@ void Writer::flushValueChangeDataConstPart_(
 			.writeLEB128(vcd.m_variable_infos.size())
 			.writeUInt(uint8_t('4'));
 		const uint64_t count{detail::ValueChangeData::encodePositionsAndwriteUniqueWaveData(
-			os, wave_data, positions, pack_type
+			os, wave_data, positions, pack_type, parallelism
 		)};
 		(void)count;
 		return std::make_pair(positions, memory_usage);
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <ctime>
 #include <fstream>
+#include <thread>
 #include <vector>
 #if __cplusplus >= 201703L
 #	include <string_view>
@@ -46,19 +47,23 @@ struct ValueChangeData {
 	~ValueChangeData();
 
 	void writeInitialBits(std::vector<uint8_t> &os) const;
-	std::vector<std::vector<uint8_t>> computeWaveData() const;
+	std::vector<std::vector<uint8_t>> computeWaveData(unsigned parallelism = 1) const;
 	static std::vector<int64_t> uniquifyWaveData(std::vector<std::vector<uint8_t>> &data);
 	static uint64_t encodePositionsAndwriteUniqueWaveData(
 		std::ostream &os,
 		const std::vector<std::vector<uint8_t>> &unique_data,
 		std::vector<int64_t> &positions,
-		WriterPackType pack_type
+		WriterPackType pack_type,
+		unsigned parallelism = 1
 	);
 	static void writeEncodedPositions(
 		const std::vector<int64_t> &encoded_positions, std::ostream &os
 	);
 	void writeTimestamps(std::vector<uint8_t> &os) const;
 	void keepOnlyTheLatestValue();
+	// Move all data into dst, and keep only the latest value of each variable in this.
+	// Unlike keepOnlyTheLatestValue(), dst can then be flushed while this accumulates.
+	void moveToKeepingTheLatestValue(ValueChangeData &dst);
 };
 
 }  // namespace detail
@@ -89,6 +94,11 @@ private:
 	uint64_t m_value_change_data_flush_threshold_{128 << 20};  // 128MB
 	uint32_t m_enum_count_{0};
 	bool m_flush_pending_{false};
+	// Parallel flushing, see setParallelism()
+	unsigned m_parallelism_{1};
+	// Background thread writing m_flushing_value_change_data_ to the file
+	std::thread m_flush_thread_{};
+	detail::ValueChangeData m_flushing_value_change_data_{};
 
 public:
 	Writer() {}
@@ -186,6 +196,13 @@ public:
 		FST_CHECK(pack_type != WriterPackType::ZLIB && pack_type != WriterPackType::FASTLZ);
 		m_pack_type_ = pack_type;
 	}
+	// Number of threads used to flush value change data, default 1 (flush on the caller).
+	// With more than 1, a block is packed and written by a background thread while the
+	// next block accumulates, and its per-variable wave data is compressed in parallel.
+	// The file content is identical either way.
+	void setParallelism(unsigned parallelism) {
+		m_parallelism_ = parallelism == 0 ? 1 : parallelism;
+	}
 
 	//////////////////////////////
 	// Create variable API
@@ -243,18 +260,42 @@ private:
 	// This function is used to flush value change data to file, and keep only the latest value in
 	// memory Just want to separate the const part from the non-const part for code clarity
 	static void flushValueChangeDataConstPart_(
-		const detail::ValueChangeData &vcd, std::ostream &os, WriterPackType pack_type
+		const detail::ValueChangeData &vcd,
+		std::ostream &os,
+		WriterPackType pack_type,
+		unsigned parallelism = 1
 	);
-	void flushValueChangeData_(detail::ValueChangeData &vcd, std::ostream &os) {
+	void flushValueChangeData_(
+		detail::ValueChangeData &vcd, std::ostream &os, bool background = false
+	) {
 		if (vcd.m_timestamps.empty()) {
 			return;
 		}
-		flushValueChangeDataConstPart_(vcd, os, m_pack_type_);
-		vcd.keepOnlyTheLatestValue();
+		// Only one block may be in flight, and blocks must reach the file in order
+		waitForFlush_();
+		if (background && m_parallelism_ > 1) {
+			vcd.moveToKeepingTheLatestValue(m_flushing_value_change_data_);
+			const WriterPackType pack_type{m_pack_type_};
+			const unsigned parallelism{m_parallelism_};
+			m_flush_thread_ = std::thread{[this, &os, pack_type, parallelism]() {
+				flushValueChangeDataConstPart_(
+					m_flushing_value_change_data_, os, pack_type, parallelism
+				);
+				// Release the memory now rather than at the next flush
+				m_flushing_value_change_data_.m_variable_infos.clear();
+				m_flushing_value_change_data_.m_timestamps.clear();
+			}};
+		} else {
+			flushValueChangeDataConstPart_(vcd, os, m_pack_type_, m_parallelism_);
+			vcd.keepOnlyTheLatestValue();
+		}
 		++m_header_.m_num_value_change_data_blocks;
 		m_value_change_data_usage_ = 0;
 		m_flush_pending_ = false;
 	}
+	void waitForFlush_() {
+		if (m_flush_thread_.joinable()) m_flush_thread_.join();
+	}
 	void finalizeHierarchy_() {
 		if (m_hierarchy_finalized_) return;
 		m_hierarchy_finalized_ = true;
@@ -53,6 +53,7 @@
 #include "verilated.h"
 
 #include "verilated_imp.h"
+#include "verilated_intrinsics.h"
 #include "verilated_sym_props.h"
 
 #include <algorithm>
@@ -657,6 +658,200 @@ void _vl_debug_print_w(int lbits, const WDataInP iwp) VL_MT_SAFE {
     VL_PRINTF_MT("\n");
 }
 
+//===========================================================================
+// Vectorized wide kernels, see VL_WIDE_VECTOR_WORDS in verilated_funcs.h
+
+// clang-format off
+#define VL_WIDE_VECTOR_OP_(name, scalarExpr, avx512Expr, avx2Expr, sse2Expr) \
+    struct name final { \
+        VL_IF_AVX512_(__m512i operator()(__m512i a, __m512i b) const { return avx512Expr; }) \
+        VL_IF_AVX2_(__m256i operator()(__m256i a, __m256i b) const { return avx2Expr; }) \
+        VL_IF_SSE2_(__m128i operator()(__m128i a, __m128i b) const { return sse2Expr; }) \
+        EData operator()(EData a, EData b) const { return scalarExpr; } \
+    }
+// As VL_WIDE_VECTOR_OP_, for an operator of 'a' alone
+#define VL_WIDE_VECTOR_UNARY_OP_(name, scalarExpr, avx512Expr, avx2Expr, sse2Expr) \
+    struct name final { \
+        VL_IF_AVX512_(__m512i operator()(__m512i a, __m512i) const { return avx512Expr; }) \
+        VL_IF_AVX2_(__m256i operator()(__m256i a, __m256i) const { return avx2Expr; }) \
+        VL_IF_SSE2_(__m128i operator()(__m128i a, __m128i) const { return sse2Expr; }) \
+        EData operator()(EData a, EData) const { return scalarExpr; } \
+    }
+#ifdef VL_HAVE_AVX512
+# define VL_IF_AVX512_(...) __VA_ARGS__
+#else
+# define VL_IF_AVX512_(...)
+#endif
+#ifdef VL_HAVE_AVX2
+# define VL_IF_AVX2_(...) __VA_ARGS__
+#else
+# define VL_IF_AVX2_(...)
+#endif
+#ifdef VL_HAVE_SSE2
+# define VL_IF_SSE2_(...) __VA_ARGS__
+#else
+# define VL_IF_SSE2_(...)
+#endif
+// clang-format on
+
+VL_WIDE_VECTOR_OP_(VlWideOpAnd, a & b, _mm512_and_si512(a, b), _mm256_and_si256(a, b),
+                   _mm_and_si128(a, b));
+VL_WIDE_VECTOR_OP_(VlWideOpOr, a | b, _mm512_or_si512(a, b), _mm256_or_si256(a, b),
+                   _mm_or_si128(a, b));
+VL_WIDE_VECTOR_OP_(VlWideOpXor, a ^ b, _mm512_xor_si512(a, b), _mm256_xor_si256(a, b),
+                   _mm_xor_si128(a, b));
+VL_WIDE_VECTOR_UNARY_OP_(VlWideOpNot, ~a, _mm512_ternarylogic_epi32(a, a, a, 0x55),
+                         _mm256_xor_si256(a, _mm256_set1_epi32(-1)),
+                         _mm_xor_si128(a, _mm_set1_epi32(-1)));
+
+// Output owp[i] = op(lwp[i], rwp[i]) for each word
+template <typename T_Op>
+static void _vl_bitop_w(int words, WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
+                        T_Op op) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_AVX512
+    for (; i + 16 <= words; i += 16) {
+        const __m512i l = _mm512_loadu_si512(lwp.datap() + i);
+        const __m512i r = _mm512_loadu_si512(rwp.datap() + i);
+        _mm512_storeu_si512(owp.datap() + i, op(l, r));
+    }
+#endif
+#ifdef VL_HAVE_AVX2
+    for (; i + 8 <= words; i += 8) {
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp.datap() + i));
+        const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp.datap() + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(owp.datap() + i), op(l, r));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    for (; i + 4 <= words; i += 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp.datap() + i));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp.datap() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp.datap() + i), op(l, r));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = op(lwp[i], rwp[i]);
+}
+
+// Return the OR of op(lwp[i], rwp[i]) over all words
+template <typename T_Op>
+static EData _vl_bitop_redor_w(int words, WDataInP const lwp, WDataInP const rwp,
+                               T_Op op) VL_PURE {
+    int i = 0;
+    EData result = 0;
+#ifdef VL_HAVE_SSE2
+    if (i + 4 <= words) {
+        __m128i acc = _mm_setzero_si128();
+#ifdef VL_HAVE_AVX2
+        if (i + 8 <= words) {
+            __m256i acc256 = _mm256_setzero_si256();
+            for (; i + 8 <= words; i += 8) {
+                acc256 = _mm256_or_si256(
+                    acc256,
+                    op(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp.datap() + i)),
+                       _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp.datap() + i))));
+            }
+            acc = _mm_or_si128(_mm256_castsi256_si128(acc256),
+                               _mm256_extracti128_si256(acc256, 1));
+        }
+#endif
+        for (; i + 4 <= words; i += 4) {
+            const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp.datap() + i));
+            const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp.datap() + i));
+            acc = _mm_or_si128(acc, op(l, r));
+        }
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0x4e));
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0xb1));
+        result |= static_cast<EData>(_mm_cvtsi128_si32(acc));
+    }
+#endif
+    for (; i < words; ++i) result |= op(lwp[i], rwp[i]);
+    return result;
+}
+
+void _vl_and_vec_w(int words, WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    _vl_bitop_w(words, owp, lwp, rwp, VlWideOpAnd{});
+}
+void _vl_or_vec_w(int words, WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    _vl_bitop_w(words, owp, lwp, rwp, VlWideOpOr{});
+}
+void _vl_xor_vec_w(int words, WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    _vl_bitop_w(words, owp, lwp, rwp, VlWideOpXor{});
+}
+void _vl_not_vec_w(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    _vl_bitop_w(words, owp, lwp, lwp, VlWideOpNot{});
+}
+EData _vl_redor_vec_w(int words, WDataInP const lwp) VL_PURE {
+    return _vl_bitop_redor_w(words, lwp, lwp, VlWideOpOr{});
+}
+EData _vl_xor_redor_vec_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_bitop_redor_w(words, lwp, rwp, VlWideOpXor{});
+}
+
+int _vl_cmp_vec_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    int i = words - 1;
+#ifdef VL_HAVE_SSE2
+    // Skip equal upper words a vector at a time, the first difference decides
+#ifdef VL_HAVE_AVX2
+    for (; i >= 7; i -= 8) {
+        const __m256i l
+            = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp.datap() + i - 7));
+        const __m256i r
+            = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp.datap() + i - 7));
+        const int eqMask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(l, r)));
+        if (eqMask != 0xff) {
+            i = i - 7 + VL_MOSTSETBITP1_I(~eqMask & 0xff) - 1;
+            return lwp[i] > rwp[i] ? 1 : -1;
+        }
+    }
+#endif
+    for (; i >= 3; i -= 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp.datap() + i - 3));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp.datap() + i - 3));
+        const int eqMask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(l, r)));
+        if (eqMask != 0xf) {
+            i = i - 3 + VL_MOSTSETBITP1_I(~eqMask & 0xf) - 1;
+            return lwp[i] > rwp[i] ? 1 : -1;
+        }
+    }
+#endif
+    for (; i >= 0; --i) {
+        if (lwp[i] > rwp[i]) return 1;
+        if (lwp[i] < rwp[i]) return -1;
+    }
+    return 0;  // ==
+}
+
+void _vl_funnel_shift_vec_w(int words, WDataOutP owp, WDataInP const hip, WDataInP const lop,
+                            int lshift) VL_MT_SAFE {
+    const int rshift = VL_EDATASIZE - lshift;
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    const __m128i lcount = _mm_cvtsi32_si128(lshift);
+    const __m128i rcount = _mm_cvtsi32_si128(rshift);
+    for (; i + 8 <= words; i += 8) {
+        const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hip.datap() + i));
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lop.datap() + i));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(owp.datap() + i),
+            _mm256_or_si256(_mm256_sll_epi32(h, lcount), _mm256_srl_epi32(l, rcount)));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+#ifndef VL_HAVE_AVX2
+    const __m128i lcount = _mm_cvtsi32_si128(lshift);
+    const __m128i rcount = _mm_cvtsi32_si128(rshift);
+#endif
+    for (; i + 4 <= words; i += 4) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hip.datap() + i));
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lop.datap() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp.datap() + i),
+                         _mm_or_si128(_mm_sll_epi32(h, lcount), _mm_srl_epi32(l, rcount)));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = (hip[i] << lshift) | (lop[i] >> rshift);
+}
+
 //===========================================================================
 // Slow expressions
 
@@ -3201,6 +3396,14 @@ std::string VerilatedContext::coverageFilename() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_coverageFilename;
 }
+void VerilatedContext::coverageBinary(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_coverageBinary = flag;
+}
+bool VerilatedContext::coverageBinary() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_coverageBinary;
+}
 void VerilatedContext::logFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     assert(m_ns.m_logFD == -1);
@@ -3352,6 +3555,10 @@ void VerilatedContext::quiet(bool flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_s.m_quiet = flag;
 }
+void VerilatedContext::runtimeStats(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_s.m_runtimeStats = flag;
+}
 void VerilatedContext::randReset(int val) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_s.m_randReset = val;
@@ -3392,8 +3599,22 @@ void VerilatedContext::threads(unsigned n) {
     }
 }
 
+void VerilatedContext::threadsSpinLimit(uint32_t value) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_threadsSpinLimit = value;
+}
+
 void VerilatedContext::useNumaAssign(bool flag) { m_useNumaAssign = flag; }
 
+void VerilatedContext::useSharedThreadPool(bool flag) {
+    if (m_threadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set shared thread pool after the thread pool has been "
+                    "created.");
+    }
+    m_useSharedThreadPool = flag;
+}
+
 void VerilatedContext::commandArgs(int argc, const char** argv) VL_MT_SAFE_EXCLUDES(m_argMutex) {
     // Not locking m_argMutex here, it is done in impp()->commandArgsAddGuts
     // m_argMutex here is the same as in impp()->commandArgsAddGuts;
@@ -3457,7 +3678,9 @@ void VerilatedContext::addModel(const VerilatedModel* modelp) {
 
 VerilatedVirtualBase* VerilatedContext::threadPoolp() {
     if (m_threads == 1) return nullptr;
-    if (!m_threadPool) m_threadPool.reset(new VlThreadPool{this, m_threads - 1});
+    if (!m_threadPool) {
+        m_threadPool.reset(new VlThreadPool{this, m_threads - 1, m_useSharedThreadPool});
+    }
     return m_threadPool.get();
 }
 
@@ -3465,6 +3688,7 @@ void VerilatedContext::prepareClone() { delete m_threadPool.release(); }
 
 VerilatedVirtualBase* VerilatedContext::threadPoolpOnClone() {
     if (VL_UNLIKELY(m_threadPool)) (void)m_threadPool.release();
+    // The shared workers do not exist in the clone, so always use its own pool
     m_threadPool = std::unique_ptr<VlThreadPool>(new VlThreadPool{this, m_threads - 1});
     return m_threadPool.get();
 }
@@ -3570,7 +3794,9 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
     if (0 == std::strncmp(arg.c_str(), "+verilator+", std::strlen("+verilator+"))) {
         std::string str;
         uint64_t u64;
-        if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
+        if (arg == "+verilator+coverage+binary") {
+            coverageBinary(true);
+        } else if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
             coverageFilename(str);
         } else if (arg == "+verilator+debug") {
             Verilated::debug(4);
@@ -3604,6 +3830,17 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
             randReset(static_cast<int>(u64));
         } else if (commandArgVlString(arg, "+verilator+solver+file+", str)) {
             solverLogFilename(str);
+        } else if (commandArgVlUint64(arg, "+verilator+solver+batch+", u64, 1, 1024)) {
+            solverBatch(static_cast<uint32_t>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+solver+fast+", u64, 0, 1)) {
+            solverFast(u64 != 0);
+        } else if (commandArgVlUint64(arg, "+verilator+solver+procs+", u64, 1, 1024)) {
+            solverProcs(static_cast<uint32_t>(u64));
+        } else if (arg == "+verilator+stats") {
+            runtimeStats(true);
+        } else if (commandArgVlUint64(arg, "+verilator+threads+spin+limit+", u64, 0,
+                                      std::numeric_limits<uint32_t>::max())) {
+            threadsSpinLimit(static_cast<uint32_t>(u64));
         } else if (commandArgVlUint64(arg, "+verilator+wno+unsatconstr+", u64, 0, 1)) {
             warnUnsatConstr(u64 == 0);  // wno means disable, so invert
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 0,
@@ -3707,6 +3944,8 @@ double VerilatedContext::statWallTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mu
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_wallTimeStart.deltaTime();
 }
+static void runCbStats() VL_MT_SAFE;  // See Verilated::addStatsCb
+
 void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
     if (quiet()) return;
     VL_PRINTF("- S i m u l a t i o n   R e p o r t: %s %s\n", Verilated::productName(),
@@ -3727,6 +3966,7 @@ void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
     const double modelMB = memPeak / 1024.0 / 1024.0;
     VL_PRINTF("- Verilator: cpu %0.3f s on %u threads; allocated %0.0f MB\n", cputime,
               threadsInModels(), modelMB);
+    if (runtimeStats()) runCbStats();
 }
 
 //======================================================================
@@ -3746,26 +3986,59 @@ void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    if (it == m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+        m_impdatap->m_nameHash.emplace(scopep->name(), scopep);
+        ++m_impdatap->m_nameGeneration;
+    }
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    if (it != m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.erase(it);
+        m_impdatap->m_nameHash.erase(scopep->name());
+        ++m_impdatap->m_nameGeneration;
+    }
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     // If too slow, can assume this is only VL_MT_SAFE_POSINIT
-    const auto& it = m_impdatap->m_nameMap.find(namep);
-    if (VL_UNLIKELY(it == m_impdatap->m_nameMap.end())) return nullptr;
+    const auto& it = m_impdatap->m_nameHash.find(namep);
+    if (VL_UNLIKELY(it == m_impdatap->m_nameHash.end())) return nullptr;
     return it->second;
 }
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
     return &(impp()->m_impdatap->m_nameMap);
 }
+uint64_t VerilatedContext::scopesGeneration() const VL_MT_SAFE {
+    return m_impdatap->m_nameGeneration;
+}
+VerilatedSignal VerilatedContext::signalFind(const char* namep) const VL_MT_SAFE_POSTINIT {
+    const uint64_t generation = scopesGeneration();
+    const std::string name{namep};
+    // Variable names may themselves contain '.' (unpacked struct members),
+    // so try each split point, longest scope first
+    for (std::string::size_type pos = name.rfind('.'); pos != std::string::npos && pos > 0;
+         pos = name.rfind('.', pos - 1)) {
+        const std::string scopeName = name.substr(0, pos);
+        if (const VerilatedScope* const scopep = scopeFind(scopeName.c_str())) {
+            if (const VerilatedVar* const varp = scopep->varFind(name.c_str() + pos + 1)) {
+                return VerilatedSignal{varp, generation};
+            }
+        }
+    }
+    // Top level ports
+    if (const VerilatedScope* const scopep = scopeFind("TOP")) {
+        if (const VerilatedVar* const varp = scopep->varFind(namep)) {
+            return VerilatedSignal{varp, generation};
+        }
+    }
+    return VerilatedSignal{};
+}
 
 //======================================================================
 // VerilatedContext:: Methods - trace
@@ -3858,6 +4131,8 @@ static struct {
     VoidPCbList s_flushCbs VL_GUARDED_BY(s_flushMutex);
     VerilatedMutex s_exitMutex;
     VoidPCbList s_exitCbs VL_GUARDED_BY(s_exitMutex);
+    VerilatedMutex s_statsMutex;
+    VoidPCbList s_statsCbs VL_GUARDED_BY(s_statsMutex);
 } VlCbStatic;
 
 static void addCbFlush(Verilated::VoidPCb cb, void* datap)
@@ -3890,6 +4165,17 @@ static void runCallbacks(const VoidPCbList& cbs) VL_MT_SAFE {
     for (const auto& i : cbs) i.first(i.second);
 }
 
+static void runCbStats() VL_MT_SAFE {
+    const VerilatedLockGuard lock{VlCbStatic.s_statsMutex};
+    runCallbacks(VlCbStatic.s_statsCbs);
+}
+void Verilated::addStatsCb(VoidPCb cb, void* datap) VL_MT_SAFE {
+    const VerilatedLockGuard lock{VlCbStatic.s_statsMutex};
+    const std::pair<Verilated::VoidPCb, void*> pair(cb, datap);
+    VlCbStatic.s_statsCbs.remove(pair);  // Just in case it's a duplicate
+    VlCbStatic.s_statsCbs.push_back(pair);
+}
+
 void Verilated::addFlushCb(VoidPCb cb, void* datap) VL_MT_SAFE { addCbFlush(cb, datap); }
 void Verilated::removeFlushCb(VoidPCb cb, void* datap) VL_MT_SAFE { removeCbFlush(cb, datap); }
 void Verilated::runFlushCallbacks() VL_MT_SAFE {
@@ -4152,8 +4438,7 @@ VerilatedVar* VerilatedScope::varInsert(const char* namep, void* datap, bool isP
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->varInsert(namep, std::move(var));
 }
 
 void VerilatedScope::varsInsertFromTable(const VlVarTableEntry* entp, size_t n,
@@ -4183,7 +4468,7 @@ void VerilatedScope::varsInsertFromTable(const VlVarTableEntry* entp, size_t n,
             for (int d = 0; d < e.pdims; ++d) packedSize *= var.m_packed[d].elements();
             var.m_packedDpi = VerilatedRange{packedSize - 1, 0};
         }
-        m_varsp->emplace(e.namep, std::move(var));
+        m_varsp->varInsert(e.namep, std::move(var));
     }
 }
 
@@ -4217,8 +4502,7 @@ VerilatedVar* VerilatedScope::varInsertSized(const char* namep, void* datap, boo
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->varInsert(namep, std::move(var));
 }
 
 VerilatedVar*
@@ -4281,16 +4565,12 @@ VerilatedScope::forceableVarInsert(const char* namep, void* datap, bool isParam,
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->varInsert(namep, std::move(var));
 }
 
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
-    if (VL_LIKELY(m_varsp)) {
-        const auto it = m_varsp->find(namep);
-        if (VL_LIKELY(it != m_varsp->end())) return &(it->second);
-    }
+    if (VL_LIKELY(m_varsp)) return m_varsp->varFind(namep);
     return nullptr;
 }
 
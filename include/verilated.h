@@ -100,6 +100,7 @@ class VerilatedFstC;
 class VerilatedFstSc;
 class VerilatedScope;
 class VerilatedScopeNameMap;
+class VerilatedSignal;
 template <typename, typename>
 class VerilatedTrace;
 class VerilatedTraceBaseC;
@@ -424,6 +425,7 @@ protected:
         bool m_gotError = false;  // A $finish statement executed
         bool m_gotFinish = false;  // A $finish or $stop statement executed
         bool m_quiet = false;  // Quiet, no summary report
+        bool m_runtimeStats = false;  // Runtime library statistics in summary report
         // Slow path
         int8_t m_timeunit;  // Time unit as 0..15
         int8_t m_timeprecision;  // Time precision as 0..15
@@ -454,13 +456,18 @@ protected:
         bool m_executingFinal = false;  // Running generated final() code
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        uint32_t m_threadsSpinLimit = VL_LOCK_SPINS;  // +threads+spin+limit iterations
         // Slow path
         std::string m_coverageFilename;  // +coverage+file filename
+        bool m_coverageBinary = false;  // +coverage+binary
         std::string m_logFilename;  // +log+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
         std::string m_profVltFilename;  // +prof+vlt filename
         std::string m_solverLogFilename;  // SMT solver log filename
         std::string m_solverProgram;  // SMT solver program
+        bool m_solverFast = true;  // +solver+fast, solve simple constraints in-process
+        uint32_t m_solverProcs = 1;  // +solver+procs, most solver processes to run
+        uint32_t m_solverBatch = 1;  // +solver+batch, solutions requested per solve
         bool m_warnUnsatConstr = true;  // Warn on unsatisfied constraints
         VlOs::DeltaCpuTime m_cpuTimeStart{false};  // CPU time, starts when create first model
         VlOs::DeltaWallTime m_wallTimeStart{false};  // Wall time, starts when create first model
@@ -485,6 +492,8 @@ protected:
     unsigned m_threads = VlOs::getProcessDefaultParallelism();
     // Use numa automatic CPU-to-thread assignment
     bool m_useNumaAssign = false;
+    // Lease worker threads from the process-wide pool instead of creating them
+    bool m_useSharedThreadPool = false;
     // Number of threads in added models
     unsigned m_threadsInModels = 0;
     // The thread pool shared by all models added to this context
@@ -594,6 +603,10 @@ public:
     bool quiet() const VL_MT_SAFE { return m_s.m_quiet; }
     /// Enable quiet (also prevents need for OS calls to get CPU time)
     void quiet(bool flag) VL_MT_SAFE;
+    /// Return if runtime library statistics are in the summary report
+    bool runtimeStats() const VL_MT_SAFE { return m_s.m_runtimeStats; }
+    /// Enable runtime library statistics in the summary report
+    void runtimeStats(bool flag) VL_MT_SAFE;
     /// Return randReset value
     int randReset() const VL_MT_SAFE { return m_s.m_randReset; }
     /// Select initial value of otherwise uninitialized signals.
@@ -664,6 +677,13 @@ public:
     /// Can only be called before the thread pool is created (before first model is added).
     void threads(unsigned n);
 
+    /// Get number of iterations a thread spins waiting for other threads before sleeping
+    uint32_t threadsSpinLimit() const VL_MT_SAFE { return m_ns.m_threadsSpinLimit; }
+    /// Set number of iterations a thread spins waiting for other threads before sleeping.
+    /// Lower values waste fewer cycles when the host is oversubscribed, at the
+    /// cost of more latency when other threads are slower than expected.
+    void threadsSpinLimit(uint32_t value) VL_MT_SAFE;
+
     /// Use numa automatic CPU-to-thread assignment.
     bool useNumaAssign() const VL_MT_SAFE { return m_useNumaAssign; }
     /// Set numa assignment of threads to cores
@@ -671,6 +691,15 @@ public:
     /// call this to override back to false if numa assignment not wanted.
     void useNumaAssign(bool flag);
 
+    /// Use worker threads shared with other contexts.
+    bool useSharedThreadPool() const VL_MT_SAFE { return m_useSharedThreadPool; }
+    /// Set to lease the threads()-1 worker threads from a process-wide pool
+    /// shared with other contexts that also set this, instead of creating
+    /// them. This allows running many contexts in one process without
+    /// oversubscribing the host. Defaults false.
+    /// Can only be called before the thread pool is created (before first model is added).
+    void useSharedThreadPool(bool flag);
+
     /// Trace signals in models within the context; called by application code
     void trace(VerilatedTraceBaseC* tfp, int levels, int options = 0);
     /// Allow traces to at some point be enabled (disables some optimizations)
@@ -688,6 +717,15 @@ public:
     /// releases - contact the authors before production use.
     void scopesDump() const VL_MT_SAFE;
 
+    /// Find a public signal by full hierarchical name, e.g. "top.sub.sig",
+    /// and return a typed view of its storage for access without the VPI.
+    /// The view is empty if not found. Requires verilated_syms.h.
+    VerilatedSignal signalFind(const char* namep) const VL_MT_SAFE_POSTINIT;
+    /// Number incremented whenever a scope is created or destroyed, i.e.
+    /// when a model is constructed or deleted. Views and pointers into
+    /// model storage obtained at an earlier generation may be stale.
+    uint64_t scopesGeneration() const VL_MT_SAFE;
+
     // METHODS - public but for internal use only
 
     // Internal: Track $finish/$stop callbacks queued by worker threads
@@ -728,6 +766,8 @@ public:
     // Internal: coverage
     std::string coverageFilename() const VL_MT_SAFE;
     void coverageFilename(const std::string& flag) VL_MT_SAFE;
+    bool coverageBinary() const VL_MT_SAFE;
+    void coverageBinary(bool flag) VL_MT_SAFE;
 
     // Internal: logfile
     std::string logFilename() const VL_MT_SAFE;
@@ -757,6 +797,15 @@ public:
     // Internal: SMT solver program
     std::string solverProgram() const VL_MT_SAFE;
     void solverProgram(const std::string& flag) VL_MT_SAFE;
+    // Internal: Solve simple constraint sets in-process instead of with the solver
+    bool solverFast() const VL_MT_SAFE { return m_ns.m_solverFast; }
+    void solverFast(bool flag) VL_MT_SAFE { m_ns.m_solverFast = flag; }
+    // Internal: Most solver processes randomize() may run concurrently
+    uint32_t solverProcs() const VL_MT_SAFE { return m_ns.m_solverProcs; }
+    void solverProcs(uint32_t flag) VL_MT_SAFE { m_ns.m_solverProcs = flag; }
+    // Internal: Solutions requested per solver round trip, extras cached
+    uint32_t solverBatch() const VL_MT_SAFE { return m_ns.m_solverBatch; }
+    void solverBatch(uint32_t flag) VL_MT_SAFE { m_ns.m_solverBatch = flag; }
     // Internal: Control display of unsatisfied constraints
     bool warnUnsatConstr() const VL_MT_SAFE { return m_ns.m_warnUnsatConstr; }
     void warnUnsatConstr(bool flag) VL_MT_SAFE { m_ns.m_warnUnsatConstr = flag; }
@@ -1097,6 +1146,10 @@ public:
     // Internal: Load a VPI shared library (+verilator+vpi+<lib>[:<bootstrap>])
     static void loadVpiLib(const std::string& arg) VL_MT_UNSAFE;
 
+    // Internal: Add callback printing runtime library statistics in statsPrintSummary,
+    // when VerilatedContext::runtimeStats()
+    static void addStatsCb(VoidPCb cb, void* datap) VL_MT_SAFE;
+
     // Internal: Get and set DPI context
     static const VerilatedScope* dpiScope() VL_MT_SAFE { return t_s.t_dpiScopep; }
     static void dpiScope(const VerilatedScope* scopep) VL_MT_SAFE { t_s.t_dpiScopep = scopep; }
@@ -28,10 +28,13 @@
 #include "verilated.h"
 #include "verilated_cov_key.h"
 
+#include <algorithm>
 #include <deque>
 #include <fstream>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -101,10 +104,80 @@ public:
 class VerilatedCovImp final : public VerilatedCovContext {
 private:
     // TYPES
-    using ValueIndexMap = std::map<const std::string, int>;
-    using IndexValueMap = std::map<int, std::string>;
+    using ValueIndexMap = std::unordered_map<std::string, int>;
+    using IndexValueMap = std::vector<std::string>;  // Indexed by value index
     using ItemList = std::deque<VerilatedCovImpItem*>;
 
+    // Output point names are built from fragments, each the formatted text of one key/value
+    // pair. Formatting is done once per unique pair, and points with the same name are found
+    // by their fragment indices, rather than by formatting and comparing the full names.
+    using Fragments = std::vector<uint32_t>;  // Indices of fragments forming a point name
+    struct Event final {  // A point to write, totalized across collapsed hierarchies
+        Fragments m_fragments;  // Name, without collapsed hierarchy
+        std::string m_hier;  // Collapsed hierarchy, or empty if per instance
+        uint64_t m_count;  // Total count
+    };
+    // Hash and equality of events by fragments, for a set of indices into a vector of events
+    struct EventHash final {
+        const std::vector<Event>& m_events;
+        size_t operator()(size_t index) const {
+            const Fragments& fragments = m_events[index].m_fragments;
+            uint64_t hash = fragments.size();
+            for (const uint32_t fragment : fragments) {
+                hash = (hash ^ fragment) * 0x100000001b3ULL;  // FNV-1a prime
+            }
+            return static_cast<size_t>(hash ^ (hash >> 32));
+        }
+    };
+    struct EventEqual final {
+        const std::vector<Event>& m_events;
+        bool operator()(size_t a, size_t b) const {
+            return m_events[a].m_fragments == m_events[b].m_fragments;
+        }
+    };
+    class Events final {  // All points to write
+    public:
+        std::vector<std::string> m_fragments;  // Text of each fragment
+        std::unordered_map<std::string, uint32_t> m_fragmentIndexes;  // Fragment text to index
+        std::unordered_map<uint64_t, uint32_t> m_pairFragments;  // Key/value index to fragment
+        std::vector<std::string> m_shortKeys;  // Short key of each key index, "" if not known
+        std::vector<Event> m_events;  // Points in order of first occurrence
+        std::unordered_set<size_t, EventHash, EventEqual> m_eventIndexes;  // Into m_events
+
+        Events()
+            : m_eventIndexes{0, EventHash{m_events}, EventEqual{m_events}} {}
+
+        uint32_t fragmentIndex(const std::string& text) {
+            const auto pair = m_fragmentIndexes.emplace(text, m_fragments.size());
+            if (pair.second) m_fragments.push_back(text);
+            return pair.first->second;
+        }
+        // Events sorted by name, without collapsed hierarchy. A fragment's only \001 is its
+        // first character, so comparing names fragment by fragment, in the order of the
+        // fragment texts, gives the same order as comparing the names.
+        std::vector<const Event*> sorted() const {
+            std::vector<uint32_t> order(m_fragments.size());
+            for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+            std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+                return m_fragments[a] < m_fragments[b];
+            });
+            std::vector<uint32_t> rank(m_fragments.size());
+            for (uint32_t i = 0; i < order.size(); ++i) rank[order[i]] = i;
+            std::vector<const Event*> events;
+            events.reserve(m_events.size());
+            for (const Event& event : m_events) events.push_back(&event);
+            std::sort(events.begin(), events.end(), [&rank](const Event* ap, const Event* bp) {
+                const Fragments& a = ap->m_fragments;
+                const Fragments& b = bp->m_fragments;
+                for (size_t i = 0; i < a.size() && i < b.size(); ++i) {
+                    if (a[i] != b[i]) return rank[a[i]] < rank[b[i]];
+                }
+                return a.size() < b.size();
+            });
+            return events;
+        }
+    };
+
     // MEMBERS
     VerilatedContext* const m_contextp;  // Context VerilatedCovImp is pointed-to by
     mutable VerilatedMutex m_mutex;  // Protects all members
@@ -132,12 +205,12 @@ protected:
 private:
     // PRIVATE METHODS
     int valueIndex(const std::string& value) VL_REQUIRES(m_mutex) {
-        const auto iter = m_valueIndexes.find(value);
-        if (iter != m_valueIndexes.end()) return iter->second;
+        const auto pair = m_valueIndexes.emplace(value, m_nextIndex + 1);
+        if (!pair.second) return pair.first->second;
         ++m_nextIndex;
         assert(m_nextIndex > 0);  // Didn't rollover
-        m_valueIndexes.emplace(value, m_nextIndex);
-        m_indexValues.emplace(m_nextIndex, value);
+        m_indexValues.resize(m_nextIndex + 1);
+        m_indexValues[m_nextIndex] = value;
         return m_nextIndex;
     }
     static std::string dequote(const std::string& text) VL_PURE {
@@ -325,17 +398,17 @@ public:
         // cppcheck-suppress autoVariables  // Used only below for insert
         valps[2] = page_default.c_str();
 
-        // Keys -> strings
-        std::array<std::string, VerilatedCovConst::MAX_KEYS> keys;
+        // Ignore empty keys
+        const char* keys[VerilatedCovConst::MAX_KEYS];
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
-            if (ckeyps[i] && ckeyps[i][0]) keys[i] = ckeyps[i];
+            keys[i] = ckeyps[i] && ckeyps[i][0] ? ckeyps[i] : nullptr;
         }
-        // Ignore empty keys
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
-            if (!keys[i].empty()) {
+            if (keys[i]) {
                 for (int j = i + 1; j < VerilatedCovConst::MAX_KEYS; ++j) {
-                    if (keys[i] == keys[j]) {  // Duplicate key.  Keep the last one
-                        keys[i] = "";
+                    if (keys[j] && 0 == std::strcmp(keys[i], keys[j])) {
+                        // Duplicate key.  Keep the last one
+                        keys[i] = nullptr;
                         break;
                     }
                 }
@@ -344,9 +417,9 @@ public:
         // Insert the values
         int addKeynum = 0;
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
-            const std::string& key = keys[i];
-            if (!keys[i].empty()) {
-                const std::string& val = valps[i];
+            if (keys[i]) {
+                const std::string key = keys[i];
+                const std::string val = valps[i];
                 // std::cout << "   " << __FUNCTION__ << "  " << key << " = " << val << "\n";
                 m_insertp->m_keys[addKeynum] = valueIndex(key);
                 m_insertp->m_vals[addKeynum] = valueIndex(val);
@@ -364,50 +437,46 @@ public:
         m_insertp = nullptr;
     }
 
-    // cppcheck-suppress duplInheritedMember
-    void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
-        Verilated::quiesce();
-        const VerilatedLockGuard lock{m_mutex};
-        selftest();
-
-        std::ofstream os{filename};
-        if (os.fail()) {
-            const std::string msg = "%Error: Can't write '"s + filename + "'";
-            VL_FATAL_MT("", 0, "", msg.c_str());
-            return;
-        }
-        os << "# SystemC::Coverage-3\n";
-
-        // Build list of events; totalize if collapsing hierarchy
-        std::map<const std::string, std::pair<std::string, uint64_t>> eventCounts;
+    // Build list of events; totalize if collapsing hierarchy
+    void buildEvents(Events& events) VL_REQUIRES(m_mutex) {
+        events.m_shortKeys.resize(m_indexValues.size());
         for (const auto& itemp : m_items) {
-            std::string name;
-            std::string hier;
+            Fragments fragments;
+            const std::string* hierp = nullptr;
             bool per_instance = false;
             if (m_forcePerInstance) per_instance = true;
 
             for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
                 if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
-                    const std::string key
-                        = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
-                    const std::string val = m_indexValues[itemp->m_vals[i]];
+                    const int keyIndex = itemp->m_keys[i];
+                    const int valIndex = itemp->m_vals[i];
+                    std::string& key = events.m_shortKeys[keyIndex];
+                    if (key.empty()) key = VerilatedCovKey::shortKey(m_indexValues[keyIndex]);
+                    const std::string& val = m_indexValues[valIndex];
                     if (key == VL_CIK_PER_INSTANCE) {
                         if (val != "0") per_instance = true;
                     }
                     if (key == VL_CIK_HIER) {
-                        hier = val;
+                        hierp = &val;
                     } else {
                         // Print it
                         if (key == "page") {
-                            const std::string type = val.substr(2, val.find('/') - 2);
-                            name += keyValueFormatter(VL_CIK_TYPE, type);
+                            // Type fragment of a page value, keyed with the undefined key
+                            const auto pair = events.m_pairFragments.emplace(valIndex, 0);
+                            if (pair.second) {
+                                const std::string type = val.substr(2, val.find('/') - 2);
+                                pair.first->second
+                                    = events.fragmentIndex(keyValueFormatter(VL_CIK_TYPE, type));
+                            }
+                            fragments.push_back(pair.first->second);
                         }
-                        name += keyValueFormatter(key, val);
+                        fragments.push_back(pairFragment(events, keyIndex, valIndex));
                     }
                 }
             }
+            std::string hier = hierp ? *hierp : "";
             if (per_instance) {  // Not collapsing hierarchies
-                name += keyValueFormatter(VL_CIK_HIER, hier);
+                fragments.push_back(events.fragmentIndex(keyValueFormatter(VL_CIK_HIER, hier)));
                 hier = "";
             }
 
@@ -417,23 +486,102 @@ public:
             // inefficient)
 
             // Find or insert the named event
-            const auto cit = eventCounts.find(name);
-            if (cit != eventCounts.end()) {
-                const std::string& oldhier = cit->second.first;
-                cit->second.second += itemp->count();
-                cit->second.first = combineHier(oldhier, hier);
-            } else {
-                eventCounts.emplace(name, std::make_pair(hier, itemp->count()));
+            events.m_events.push_back(Event{std::move(fragments), hier, itemp->count()});
+            const auto pair = events.m_eventIndexes.emplace(events.m_events.size() - 1);
+            if (!pair.second) {
+                Event& event = events.m_events[*pair.first];
+                event.m_count += itemp->count();
+                if (event.m_hier != hier) event.m_hier = combineHier(event.m_hier, hier);
+                events.m_events.pop_back();
             }
         }
+    }
+    uint32_t pairFragment(Events& events, int keyIndex, int valIndex) VL_REQUIRES(m_mutex) {
+        const uint64_t pairKey = (static_cast<uint64_t>(keyIndex) << 32) | valIndex;
+        const auto pair = events.m_pairFragments.emplace(pairKey, 0);
+        if (pair.second) {
+            pair.first->second = events.fragmentIndex(
+                keyValueFormatter(events.m_shortKeys[keyIndex], m_indexValues[valIndex]));
+        }
+        return pair.first->second;
+    }
+    static void writeText(std::ofstream& os, const Events& events) {
+        os << "# SystemC::Coverage-3\n";
+        std::string buf;
+        for (const Event* const eventp : events.sorted()) {
+            buf += "C '";
+            for (const uint32_t fragment : eventp->m_fragments) {
+                buf += events.m_fragments[fragment];
+            }
+            if (!eventp->m_hier.empty()) buf += keyValueFormatter(VL_CIK_HIER, eventp->m_hier);
+            buf += "' ";
+            buf += std::to_string(eventp->m_count);
+            buf += '\n';
+            if (buf.size() >= (1 << 16)) {
+                os.write(buf.data(), buf.size());
+                buf.clear();
+            }
+        }
+        os.write(buf.data(), buf.size());
+    }
+    static void writeBinary(std::ofstream& os, Events& events) {
+        // See VL_COV_BINARY_MAGIC for the format. Points are sorted as in the text format,
+        // which makes reading them faster.
+        const auto put32 = [](std::string& buf, uint32_t value) {
+            for (int i = 0; i < 4; ++i) buf += static_cast<char>(value >> (8 * i));
+        };
+        const auto put64 = [](std::string& buf, uint64_t value) {
+            for (int i = 0; i < 8; ++i) buf += static_cast<char>(value >> (8 * i));
+        };
+        const std::vector<const Event*> sorted = events.sorted();
+        // Collapsed hierarchies become another fragment of the name
+        std::vector<uint32_t> hierFragments;
+        hierFragments.reserve(sorted.size());
+        for (const Event* const eventp : sorted) {
+            hierFragments.push_back(
+                eventp->m_hier.empty()
+                    ? 0
+                    : events.fragmentIndex(keyValueFormatter(VL_CIK_HIER, eventp->m_hier)) + 1);
+        }
+        std::string buf = VL_COV_BINARY_MAGIC;
+        put32(buf, static_cast<uint32_t>(events.m_fragments.size()));
+        for (const std::string& fragment : events.m_fragments) {
+            put32(buf, static_cast<uint32_t>(fragment.size()));
+            buf += fragment;
+        }
+        put64(buf, sorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            const Fragments& fragments = sorted[i]->m_fragments;
+            const uint32_t hierFragment = hierFragments[i];
+            put32(buf, static_cast<uint32_t>(fragments.size() + (hierFragment ? 1 : 0)));
+            for (const uint32_t fragment : fragments) put32(buf, fragment);
+            if (hierFragment) put32(buf, hierFragment - 1);
+        }
+        for (const Event* const eventp : sorted) put64(buf, eventp->m_count);
+        os.write(buf.data(), buf.size());
+    }
+
+public:
+    // cppcheck-suppress duplInheritedMember
+    void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        Verilated::quiesce();
+        const VerilatedLockGuard lock{m_mutex};
+        selftest();
+
+        const bool binary = m_contextp->coverageBinary();
+        std::ofstream os{filename, binary ? std::ios::out | std::ios::binary : std::ios::out};
+        if (os.fail()) {
+            const std::string msg = "%Error: Can't write '"s + filename + "'";
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            return;
+        }
 
-        // Output body
-        for (const auto& i : eventCounts) {
-            os << "C '" << std::dec;
-            os << i.first;
-            if (!i.second.first.empty()) os << keyValueFormatter(VL_CIK_HIER, i.second.first);
-            os << "' " << i.second.second;
-            os << '\n';
+        Events events;
+        buildEvents(events);
+        if (binary) {
+            writeBinary(os, events);
+        } else {
+            writeText(os, events);
         }
     }
 };
@@ -68,6 +68,20 @@ VLCOVGEN_ITEM("'name':'weight',      'short':'w',  'group':0, 'default':None, 'd
 #define VL_CIK_WEIGHT "w"
 // VLCOVGEN_CIK_AUTO_EDIT_END
 
+//=============================================================================
+// Binary coverage database format
+//
+// Optionally written by VerilatedCovContext::write instead of the text format
+// (see +verilator+coverage+binary), and read by verilator_coverage. A point's
+// name is the concatenation of its fragments, as the text format has it between
+// quotes. All integers are little-endian:
+//   VL_COV_BINARY_MAGIC
+//   u32 number of fragments, then per fragment: u32 length, characters
+//   u64 number of points, then per point: u32 number of fragments, u32 index of each
+//   u64 count of each point
+
+#define VL_COV_BINARY_MAGIC "# SystemC::Coverage-3-binary\n"
+
 //=============================================================================
 // VerilatedCovKey
 // Namespace-style static class for \internal use.
@@ -76,7 +76,9 @@ void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     m_fst = new fst::Writer{filename};  // LCOV_EXCL_BR_LINE
     m_fst->setWriterPackType(fst::WriterPackType::LZ4);
     m_fst->setTimecale(int8_t(round(log10(timeRes()))));
-    // if (m_useFstWriterThread) fstWriterSetParallelMode(m_fst, 1);
+    // Pack and compress value change blocks on background threads if requested, so a
+    // flush overlaps with simulation rather than stalling it
+    m_fst->setParallelism(m_flushThreads);
     m_fst->setWriter("Generated by VerilatedFst");
     constDump(true);  // First dump must contain the const signals
     fullDump(true);  // First dump must be full for fst
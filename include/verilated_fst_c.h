@@ -59,6 +59,7 @@ private:
     vlFstHandle* m_symbolp = nullptr;  // same as m_code2symbol, but as an array
     char* m_strbufp = nullptr;  // String buffer long enough to hold maxBits() chars
     uint64_t m_timeui = 0;  // Time to emit, 0 = not needed
+    unsigned m_flushThreads = 1;  // Threads packing each value change block, 1 = serial
 
     // Prefixes to add to signal names/scope types
     std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
@@ -97,6 +98,10 @@ public:
     explicit VerilatedFst(void* fst = nullptr);
     ~VerilatedFst();
 
+    // ACCESSORS
+    // Set threads to pack and write value change blocks with, takes effect on next open
+    void flushThreads(unsigned threads) VL_MT_SAFE { m_flushThreads = threads ? threads : 1; }
+
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
     void open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex);
@@ -196,6 +201,10 @@ template <>
 void VerilatedFst::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedFst::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedFst::Super::triggerHistory(uint64_t dumps);
+template <>
+void VerilatedFst::Super::trigger();
 #endif
 
 //=============================================================================
@@ -260,6 +269,10 @@ public:
     bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
     /// Open a new FST file
     virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    /// Set threads to pack and write value change blocks with, call before open.
+    /// With more than one, each block is written in the background overlapping
+    /// with simulation. The file is identical to one written serially (the default).
+    void flushThreads(unsigned threads) VL_MT_SAFE { m_sptrace.flushThreads(threads); }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
@@ -276,6 +289,12 @@ public:
     void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    /// Hold back at least the last 'dumps' calls to dump() in memory, and
+    /// write them only on trigger(), or on $stop, $fatal or a failed assertion.
+    /// Zero stops holding back, discarding the dumps held so far.
+    void triggerHistory(uint64_t dumps) VL_MT_SAFE { m_sptrace.triggerHistory(dumps); }
+    /// Write the held back dumps, then continue writing each dump as usual
+    void trigger() VL_MT_SAFE { m_sptrace.trigger(); }
 
     // METHODS - Internal/backward compatible
     // \protectedsection
@@ -692,6 +692,50 @@ inline WDataOutP VL_EXTENDS_WW(int obits, int lbits, WDataOutP owp,
     return VL_MEMCPY_W(owp, lwp, lwords - 1);
 }
 
+//===================================================================
+// VECTORIZED WIDE HELPERS
+// Internal usage. Operands of at least VL_WIDE_VECTOR_WORDS words go to kernels in
+// verilated.cpp, which process several EData words per instruction using the widest
+// vector extension enabled at compile time (see verilated_intrinsics.h). Narrower
+// operands use plain loops, and model code need not include the intrinsics headers.
+
+// Little endian targets may operate on pairs of EData as one 64-bit limb
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && !defined(VL_PORTABLE_ONLY)
+#define VL_WIDE_QUAD_LIMBS 1
+#endif
+
+#define VL_WIDE_VECTOR_WORDS 8  // Minimum words to use a vector kernel
+
+extern void _vl_and_vec_w(int words, WDataOutP owp, WDataInP const lwp,
+                          WDataInP const rwp) VL_MT_SAFE;
+extern void _vl_or_vec_w(int words, WDataOutP owp, WDataInP const lwp,
+                         WDataInP const rwp) VL_MT_SAFE;
+extern void _vl_xor_vec_w(int words, WDataOutP owp, WDataInP const lwp,
+                          WDataInP const rwp) VL_MT_SAFE;
+extern void _vl_not_vec_w(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE;
+// Return the OR of all words
+extern EData _vl_redor_vec_w(int words, WDataInP const lwp) VL_PURE;
+// Return the OR of lwp[i] ^ rwp[i] over all words
+extern EData _vl_xor_redor_vec_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE;
+// Return <0, 0 or >0 as lwp is less than, equal to or greater than rwp
+extern int _vl_cmp_vec_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE;
+// See _vl_funnel_shift_w
+extern void _vl_funnel_shift_vec_w(int words, WDataOutP owp, WDataInP const hip,
+                                   WDataInP const lop, int lshift) VL_MT_SAFE;
+
+// Output owp[i] = (hip[i] << lshift) | (lop[i] >> (VL_EDATASIZE - lshift)), 0 < lshift < 32.
+// Writing owp may overlap reading hip/lop only if owp <= lop < hip.
+inline void _vl_funnel_shift_w(int words, WDataOutP owp, WDataInP const hip, WDataInP const lop,
+                               int lshift) VL_MT_SAFE {
+    if (words >= VL_WIDE_VECTOR_WORDS) {
+        _vl_funnel_shift_vec_w(words, owp, hip, lop, lshift);
+        return;
+    }
+    const int rshift = VL_EDATASIZE - lshift;
+    for (int i = 0; i < words; ++i) owp[i] = (hip[i] << lshift) | (lop[i] >> rshift);
+}
+
 //===================================================================
 // REDUCTION OPERATORS
 
@@ -711,6 +755,7 @@ inline IData VL_REDAND_IW(int lbits, WDataInP const lwp) VL_PURE {
 #define VL_REDOR_I(lhs) ((lhs) != 0)
 #define VL_REDOR_Q(lhs) ((lhs) != 0)
 inline IData VL_REDOR_W(int words, WDataInP const lwp) VL_PURE {
+    if (words >= VL_WIDE_VECTOR_WORDS) return _vl_redor_vec_w(words, lwp) != 0;
     EData equal = 0;
     for (int i = 0; i < words; ++i) equal |= lwp[i];
     return (equal != 0);
@@ -928,17 +973,26 @@ inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    if (words >= VL_WIDE_VECTOR_WORDS) {
+        _vl_and_vec_w(words, owp, lwp, rwp);
+    } else {
+        for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    }
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                          WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    if (words >= VL_WIDE_VECTOR_WORDS) {
+        _vl_or_vec_w(words, owp, lwp, rwp);
+    } else {
+        for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    }
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    if (words >= VL_WIDE_VECTOR_WORDS) return _vl_xor_redor_vec_w(words, lwp, rwp);
     IData od = 0;
     for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
     return od;
@@ -946,12 +1000,20 @@ inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) V
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    if (words >= VL_WIDE_VECTOR_WORDS) {
+        _vl_xor_vec_w(words, owp, lwp, rwp);
+    } else {
+        for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    }
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
+    if (words >= VL_WIDE_VECTOR_WORDS) {
+        _vl_not_vec_w(words, owp, lwp);
+    } else {
+        for (int i = 0; i < words; ++i) owp[i] = ~lwp[i];
+    }
     return owp;
 }
 
@@ -973,6 +1035,7 @@ inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SA
 
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    if (words >= VL_WIDE_VECTOR_WORDS) return _vl_xor_redor_vec_w(words, lwp, rwp) == 0;
     EData nequal = 0;
     for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
     return (nequal == 0);
@@ -1040,6 +1103,7 @@ inline IData VL_EQ_R(int words, const VlQueue<VlWide<N_Words>>& q, WDataInP cons
 
 // Internal usage
 inline int _vl_cmp_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    if (words >= VL_WIDE_VECTOR_WORDS) return _vl_cmp_vec_w(words, lwp, rwp);
     for (int i = words - 1; i >= 0; --i) {
         if (lwp[i] > rwp[i]) return 1;
         if (lwp[i] < rwp[i]) return -1;
@@ -1151,7 +1215,21 @@ inline QData VL_MODDIV_QQQ(int /*lbits*/, QData lhs, QData rhs) {
 inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+    int i = 0;
+#ifdef VL_WIDE_QUAD_LIMBS
+    // Propagate the carry across two words at a time
+    for (; i + 2 <= words; i += 2) {
+        QData lhs;
+        QData rhs;
+        std::memcpy(&lhs, lwp.datap() + i, sizeof(QData));
+        std::memcpy(&rhs, rwp.datap() + i, sizeof(QData));
+        const QData sum = lhs + rhs;
+        const QData out = sum + carry;
+        carry = static_cast<QData>(sum < lhs) | static_cast<QData>(out < sum);
+        std::memcpy(owp.datap() + i, &out, sizeof(QData));
+    }
+#endif
+    for (; i < words; ++i) {
         carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
@@ -1162,11 +1240,24 @@ inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
 
 inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
-    QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+    QData carry = 1;  // Negation of rwp
+    int i = 0;
+#ifdef VL_WIDE_QUAD_LIMBS
+    // Propagate the carry across two words at a time
+    for (; i + 2 <= words; i += 2) {
+        QData lhs;
+        QData rhs;
+        std::memcpy(&lhs, lwp.datap() + i, sizeof(QData));
+        std::memcpy(&rhs, rwp.datap() + i, sizeof(QData));
+        const QData sum = lhs + ~rhs;
+        const QData out = sum + carry;
+        carry = static_cast<QData>(sum < lhs) | static_cast<QData>(out < sum);
+        std::memcpy(owp.datap() + i, &out, sizeof(QData));
+    }
+#endif
+    for (; i < words; ++i) {
         carry = (carry + static_cast<QData>(lwp[i])
                  + static_cast<QData>(static_cast<IData>(~rwp[i])));
-        if (i == 0) ++carry;  // Negation of rwp
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
     }
@@ -2517,8 +2608,11 @@ inline WDataOutP VL_SHIFTL_WWI(int obits, int, int, WDataOutP owp, WDataInP cons
         for (int i = 0; i < word_shift; ++i) owp[i] = 0;
         for (int i = word_shift; i < VL_WORDS_I(obits); ++i) owp[i] = lwp[i - word_shift];
     } else {
-        for (int i = 0; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
-        _vl_insert_WW(owp, lwp, obits - 1, rd);
+        const int words = VL_WORDS_I(obits);
+        for (int i = 0; i < word_shift; ++i) owp[i] = 0;
+        owp[word_shift] = lwp[0] << bit_shift;
+        _vl_funnel_shift_w(words - word_shift - 1, owp + word_shift + 1, lwp + 1, lwp, bit_shift);
+        owp[words - 1] &= VL_MASK_E(obits);
     }
     return owp;
 }
@@ -2589,7 +2683,11 @@ inline WDataOutP VL_SHIFTR_WWI(int obits, int, int, WDataOutP owp, WDataInP cons
         const int nbitsonright = VL_EDATASIZE - loffset;  // bits that end up in lword (know
                                                           // loffset!=0) Middle words
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
+        // Words with an upper neighbor to take bits from
+        const int funnelWords = std::min(words, VL_WORDS_I(obits) - word_shift - 1);
+        _vl_funnel_shift_w(funnelWords, owp, lwp + word_shift + 1, lwp + word_shift,
+                           nbitsonright);
+        for (int i = funnelWords; i < words; ++i) {
             owp[i] = lwp[i + word_shift] >> loffset;
             const int upperword = i + word_shift + 1;
             if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
@@ -2668,7 +2766,11 @@ inline WDataOutP VL_SHIFTRS_WWI(int obits, int lbits, int, WDataOutP owp, WDataI
             = VL_EDATASIZE - loffset;  // bits that end up in lword (know loffset!=0)
         // Middle words
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
+        // Words with an upper neighbor to take bits from
+        const int funnelWords = std::min(words, VL_WORDS_I(obits) - word_shift - 1);
+        _vl_funnel_shift_w(funnelWords, owp, lwp + word_shift + 1, lwp + word_shift,
+                           nbitsonright);
+        for (int i = funnelWords; i < words; ++i) {
             owp[i] = lwp[i + word_shift] >> loffset;
             const int upperword = i + word_shift + 1;
             if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
@@ -33,6 +33,7 @@
 #include "verilated_syms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <limits>
 #include <map>
@@ -207,6 +208,10 @@ protected:
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
     mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Hashed index over m_nameMap, used by scopeFind
+    VerilatedScopeNameHash m_nameHash VL_GUARDED_BY(m_nameMutex);
+    // Incremented on each scopeInsert/scopeErase, so lookup caches can detect stale entries
+    std::atomic<uint64_t> m_nameGeneration{0};
 };
 
 //======================================================================
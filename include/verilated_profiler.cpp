@@ -159,6 +159,11 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     }
     fprintf(fp, "VLPROF stat threads %u\n", threads);
     fprintf(fp, "VLPROF stat yields %" PRIu64 "\n", VlMTaskVertex::yields());
+    fprintf(fp, "VLPROF stat waits_spun %" PRIu64 "\n", VlMTaskVertex::waitsSpun());
+    fprintf(fp, "VLPROF stat waits_slept %" PRIu64 "\n", VlMTaskVertex::waitsSlept());
+    if (const uint64_t steals = VlThreadPool::steals()) {
+        fprintf(fp, "VLPROF stat steals %" PRIu64 "\n", steals);
+    }
 
     // Copy /proc/cpuinfo into this output so verilator_gantt can be run on
     // a different machine
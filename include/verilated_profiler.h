@@ -217,9 +217,16 @@ class VlPgoProfiler final {
         const size_t m_counterNumber = 0;  // Which counter has data
     };
 
+    struct LogicRecord final {
+        const std::string m_name;  // Hashed name of logic block
+        const size_t m_counterNumber = 0;  // Which counter (mtask) contains the logic
+        const uint32_t m_cost = 0;  // Estimated cost, to apportion the counter by
+    };
+
     // Counters are stored packed, all together to reduce cache effects
     std::array<uint64_t, N_Entries> m_counters{};  // Time spent on this record
     std::vector<Record> m_records;  // Record information
+    std::vector<LogicRecord> m_logicRecords;  // Logic block information
     // An original cost of a profiled hier block. During Verilation with
     // collected profiling data, costs of hier blocks change thus hashes of
     // original mtasks does not match those from the previous,
@@ -242,6 +249,10 @@ public:
         VL_DEBUG_IF(assert(counter < N_Entries););
         m_records.emplace_back(Record{name, counter});
     }
+    void addLogic(size_t counter, const std::string& name, uint32_t cost) {
+        VL_DEBUG_IF(assert(counter < N_Entries););
+        m_logicRecords.emplace_back(LogicRecord{name, counter, cost});
+    }
     void startCounter(size_t counter) {
         // -= so when we add end time in stopCounter, the net effect is adding the difference,
         // without needing to hold onto a temporary
@@ -299,6 +310,20 @@ void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& file
                 rec.m_name.c_str(), m_counters[rec.m_counterNumber]);
     }
 
+    // Apportion the time of each mtask to its logic blocks in proportion of their estimated
+    // costs, so Verilation can reuse the profile even after mtasks are contracted differently
+    std::vector<uint64_t> estimates(N_Entries);
+    for (const LogicRecord& rec : m_logicRecords) estimates[rec.m_counterNumber] += rec.m_cost;
+    for (const LogicRecord& rec : m_logicRecords) {
+        const uint64_t estimate = estimates[rec.m_counterNumber];
+        const uint64_t cost
+            = estimate ? static_cast<uint64_t>(static_cast<double>(m_counters[rec.m_counterNumber])
+                                               * rec.m_cost / estimate)
+                       : 0;
+        fprintf(fp, "profile_data -model \"%s\" -logic \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
+                rec.m_name.c_str(), cost);
+    }
+
     std::fclose(fp);
 }
 
@@ -23,15 +23,21 @@
 
 #include "verilated_random.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <streambuf>
+#include <unordered_map>
 
-// Diversity (scalar rand vars): tie each free bit to a random target via a
-//   boolean assumption literal, then force the bits with (check-sat-assuming).
+// Diversity (scalar rand vars): each free bit has a boolean literal declared
+//   with the session; assume it at a random target polarity with
+//   (check-sat-assuming).
 //   If UNSAT, (get-unsat-assumptions) names the literals clashing with the
 //   feasible hard+soft base; drop one per round and recheck until SAT, which
 //   keeps the maximal set of bits compatible with the constraints. Only these
@@ -78,6 +84,10 @@ class VlRProcess final : private std::streambuf, public std::iostream {
     std::unique_ptr<std::ofstream> m_logfp;  // Log file stream
     uint64_t m_logLastTime = ~0ULL;  // Last timestamp for logfile
 
+    // Context kept open between randomize() calls; see VlRandomizer::syncSession
+    std::string m_sessionDeclares;  // Logic, defines and declarations, empty if none open
+    std::vector<std::string> m_sessionAsserted;  // Hard constraints, one push level each
+
 public:
     typedef std::streambuf::traits_type traits_type;
 
@@ -118,14 +128,24 @@ protected:
     }
 
 public:
-    explicit VlRProcess(const char* const* const cmd = nullptr)
+    // Process logIndex > 0 logs to the solver log filename with .<logIndex> appended
+    explicit VlRProcess(const char* const* const cmd = nullptr, size_t logIndex = 0)
         : std::streambuf{}
         , std::iostream{this}
         , m_cmd{cmd} {
-        logOpen();
+        logOpen(logIndex);
         open(cmd);
     }
 
+    // Drop all declarations and assertions, closing any open session
+    void reset() {
+        *this << "(reset)\n";
+        m_sessionDeclares.clear();
+        m_sessionAsserted.clear();
+    }
+    std::string& sessionDeclares() { return m_sessionDeclares; }
+    std::vector<std::string>& sessionAsserted() { return m_sessionAsserted; }
+
     void wait_report() {
         if (m_pidExited) return;
 #ifdef _VL_SOLVER_PIPE
@@ -234,9 +254,10 @@ public:
     }
 
 private:
-    void logOpen() {
-        const std::string filename = Verilated::threadContextp()->solverLogFilename();
+    void logOpen(size_t logIndex) {
+        std::string filename = Verilated::threadContextp()->solverLogFilename();
         if (filename.empty()) return;
+        if (logIndex) filename += "." + std::to_string(logIndex);
         m_logfp = std::make_unique<std::ofstream>(filename);
         if (m_logfp.get() && m_logfp.get()->fail()) m_logfp = nullptr;
         if (!m_logfp) {
@@ -263,44 +284,175 @@ private:
     }
 };
 
-static VlRProcess& getSolver() {
-    static VlRProcess s_solver;
-    static bool s_done = false;
-    if (s_done) return s_solver;
-    s_done = true;
-
-    static std::vector<const char*> s_argv;
-    static std::string s_program = Verilated::threadContextp()->solverProgram();
-    s_argv.emplace_back(&s_program[0]);
-    for (char* arg = &s_program[0]; *arg; ++arg) {
-        if (*arg == ' ') {
-            *arg = '\0';
-            s_argv.emplace_back(arg + 1);
-        }
-    }
-    s_argv.emplace_back(nullptr);
-
-    const char* const* const cmd = &s_argv[0];
-    s_solver.open(cmd);
-    s_solver << "(set-logic QF_ABV)\n";
-    s_solver << "(check-sat)\n";
-    s_solver << "(reset)\n";
-    std::string s;
-    getline(s_solver, s);
-    if (s == "sat") return s_solver;
-
-    std::stringstream msg;
-    msg << "Unable to communicate with SAT solver, please check its installation or specify a "
-           "different one in VERILATOR_SOLVER environment variable.\n";
-    msg << " ... Tried: $";
-    for (const char* const* arg = cmd; *arg; ++arg) msg << ' ' << *arg;
-    msg << '\n';
-    const std::string str = msg.str();
-    VL_WARN_MT("", 0, "randomize", str.c_str());
-
-    while (getline(s_solver, s)) {}
-    return s_solver;
-}
+// Solver processes shared by all randomizers, started on demand up to
+// +verilator+solver+procs. Each keeps the session of the class it last solved
+// (see VlRandomizer::syncSession), so a lease prefers an idle process already
+// holding the caller's declarations, then a new process, then the least
+// recently used idle one.
+class VlRSolverPool final {
+    // MEMBERS
+    mutable VerilatedMutex m_mutex;  // Protects all members below
+    std::condition_variable_any m_cv;  // Signaled when a process is released
+    std::vector<std::unique_ptr<VlRProcess>> m_procs VL_GUARDED_BY(m_mutex);
+    std::vector<bool> m_busy VL_GUARDED_BY(m_mutex);  // Leased, per m_procs entry
+    std::vector<uint64_t> m_lastUse VL_GUARDED_BY(m_mutex);  // Release order, per m_procs entry
+    uint64_t m_releases VL_GUARDED_BY(m_mutex) = 0;  // Releases so far
+    bool m_spawnFailed VL_GUARDED_BY(m_mutex) = false;  // Start no more processes
+    size_t m_starting VL_GUARDED_BY(m_mutex) = 0;  // Processes being started
+    std::string m_program;  // Solver command line, split in place into m_argv
+    std::vector<const char*> m_argv;  // fork() process argv
+
+    // CONSTRUCTORS
+    VlRSolverPool()
+        : m_program{Verilated::threadContextp()->solverProgram()} {
+        m_argv.emplace_back(&m_program[0]);
+        for (char* arg = &m_program[0]; *arg; ++arg) {
+            if (*arg == ' ') {
+                *arg = '\0';
+                m_argv.emplace_back(arg + 1);
+            }
+        }
+        m_argv.emplace_back(nullptr);
+    }
+
+    // METHODS
+    bool startup(VlRProcess& proc) {
+        proc << "(set-logic QF_ABV)\n";
+        proc << "(check-sat)\n";
+        proc << "(reset)\n";
+        std::string s;
+        getline(proc, s);
+        if (s == "sat") return true;
+
+        std::stringstream msg;
+        msg << "Unable to communicate with SAT solver, please check its installation or specify "
+               "a different one in VERILATOR_SOLVER environment variable.\n";
+        msg << " ... Tried: $";
+        for (const char* const* arg = &m_argv[0]; *arg; ++arg) msg << ' ' << *arg;
+        msg << '\n';
+        const std::string str = msg.str();
+        VL_WARN_MT("", 0, "randomize", str.c_str());
+
+        while (getline(proc, s)) {}
+        return false;
+    }
+
+public:
+    static VlRSolverPool& instance() {
+        static VlRSolverPool s_pool;
+        return s_pool;
+    }
+    // Lease a process, waiting if all are busy; returns its index in idxr
+    VlRProcess& acquire(const std::string& declares, size_t& idxr) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const size_t maxProcs = Verilated::threadContextp()->solverProcs();
+        while (true) {
+            size_t logIndex;
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                while (true) {
+                    size_t match = m_procs.size();
+                    size_t lru = m_procs.size();
+                    for (size_t i = 0; i < m_procs.size(); ++i) {
+                        if (m_busy[i]) continue;
+                        if (!declares.empty() && m_procs[i]->sessionDeclares() == declares) {
+                            match = i;
+                            break;
+                        }
+                        if (lru == m_procs.size() || m_lastUse[i] < m_lastUse[lru]) lru = i;
+                    }
+                    const size_t started = m_procs.size() + m_starting;
+                    if (match == m_procs.size() && !m_spawnFailed
+                        && (started == 0 || started < maxProcs)) {
+                        logIndex = started;
+                        ++m_starting;
+                        break;  // Start a new process, below
+                    }
+                    if (match == m_procs.size()) match = lru;
+                    if (match != m_procs.size()) {
+                        m_busy[match] = true;
+                        idxr = match;
+                        return *m_procs[match];
+                    }
+                    m_cv.wait(m_mutex);
+                }
+            }
+            // Started without the lock, as the startup round trip waits on the solver
+            std::unique_ptr<VlRProcess> procp{new VlRProcess{&m_argv[0], logIndex}};
+            const bool ok = startup(*procp);
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                --m_starting;
+                if (!ok) m_spawnFailed = true;
+                // Keep a broken first process so callers see its failed stream
+                if (ok || m_procs.empty()) {
+                    idxr = m_procs.size();
+                    m_procs.push_back(std::move(procp));
+                    m_busy.push_back(true);
+                    m_lastUse.push_back(0);
+                    return *m_procs[idxr];
+                }
+            }
+            // Others may be waiting for this process; lease an existing one instead
+            m_cv.notify_all();
+        }
+    }
+    void release(size_t idx) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_busy[idx] = false;
+            m_lastUse[idx] = ++m_releases;
+        }
+        m_cv.notify_all();
+    }
+};
+
+// Exclusive use of one pool process for the lifetime of the lease
+class VlRSolverLease final {
+    size_t m_idx = 0;  // Index in the pool
+    VlRProcess& m_proc;  // Leased process
+
+public:
+    explicit VlRSolverLease(const std::string& declares)
+        : m_proc{VlRSolverPool::instance().acquire(declares, m_idx)} {}
+    ~VlRSolverLease() { VlRSolverPool::instance().release(m_idx); }
+    VlRProcess& proc() const { return m_proc; }
+    VL_UNCOPYABLE(VlRSolverLease);
+};
+
+// Solutions solved ahead under +verilator+solver+batch, keyed by the complete
+// constraint text, state values included, so any later call with the same
+// text may take one
+class VlRSolutionCache final {
+public:
+    using Solution = std::vector<std::pair<std::string, std::string>>;  // Var, SMT value
+
+private:
+    static constexpr size_t MAX_KEYS = 256;  // Cleared when more are cached
+    VerilatedMutex m_mutex;  // Protects m_solutions
+    std::unordered_map<std::string, std::vector<Solution>> m_solutions VL_GUARDED_BY(m_mutex);
+
+public:
+    static VlRSolutionCache& instance() {
+        static VlRSolutionCache s_cache;
+        return s_cache;
+    }
+    bool take(const std::string& key, Solution& solutionr) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        const auto it = m_solutions.find(key);
+        if (it == m_solutions.end()) return false;
+        solutionr = std::move(it->second.back());
+        it->second.pop_back();
+        if (it->second.empty()) m_solutions.erase(it);
+        return true;
+    }
+    void put(const std::string& key, std::vector<Solution>&& solutions)
+        VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (solutions.empty()) return;
+        const VerilatedLockGuard lock{m_mutex};
+        if (m_solutions.size() >= MAX_KEYS && !m_solutions.count(key)) m_solutions.clear();
+        m_solutions[key] = std::move(solutions);
+    }
+};
 
 static std::string readUntilBalanced(std::istream& stream) {
     std::string result;
@@ -320,6 +472,33 @@ static std::string readUntilBalanced(std::istream& stream) {
     return result;
 }
 
+// One whole solver reply: an atom such as "sat", or a balanced S-expression
+// such as a get-value model or an (error "...") message
+static std::string readReply(std::istream& stream) {
+    std::string result;
+    int depth = 0;
+    bool quoted = false;
+    int ci;
+    while ((ci = stream.peek()) != std::char_traits<char>::eof()) {
+        const char c = static_cast<char>(ci);
+        const bool space = std::isspace(static_cast<unsigned char>(c));
+        if (!quoted && !depth && !result.empty() && (space || c == '(' || c == ')')) {
+            break;  // End of an atom
+        }
+        stream.get();
+        if (result.empty() && space) continue;
+        result += c;
+        if (c == '"') {
+            quoted = !quoted;
+        } else if (!quoted && c == '(') {
+            ++depth;
+        } else if (!quoted && c == ')' && --depth <= 0) {
+            break;
+        }
+    }
+    return result;
+}
+
 static std::string parseNestedSelect(const std::string& nested_select_expr,
                                      std::vector<std::string>& indices) {
     std::istringstream nestedStream(nested_select_expr);
@@ -335,6 +514,560 @@ static std::string parseNestedSelect(const std::string& nested_select_expr,
     return name;
 }
 
+//======================================================================
+// In-process fast path
+//
+// Constraint sets where every hard and soft constraint bounds a single
+// scalar rand variable against constants (ranges, inside sets, lowered dist
+// buckets, ==, !=, and conjunctions/disjunctions of those on one variable)
+// need no solver: each variable's allowed values are an interval set,
+// constraints on different variables intersect independently, and a value is
+// drawn uniformly from each set. State values are already literals in the
+// constraint text, so the plan is rebuilt only when that text changes.
+
+// Set of unsigned values as sorted, disjoint, non-adjacent closed ranges
+class VlRandomDomain final {
+    using Range = std::pair<uint64_t, uint64_t>;
+    std::vector<Range> m_ranges;
+
+    void normalize() {
+        std::sort(m_ranges.begin(), m_ranges.end());
+        size_t out = 0;
+        for (const Range& r : m_ranges) {
+            Range* const lastp = out ? &m_ranges[out - 1] : nullptr;
+            if (lastp && (lastp->second == ~0ULL || r.first <= lastp->second + 1)) {
+                lastp->second = std::max(lastp->second, r.second);
+            } else {
+                m_ranges[out++] = r;
+            }
+        }
+        m_ranges.resize(out);
+    }
+    void add(uint64_t lo, uint64_t hi) {
+        if (lo <= hi) m_ranges.emplace_back(lo, hi);
+    }
+
+public:
+    VlRandomDomain() = default;
+    VlRandomDomain(uint64_t lo, uint64_t hi) { add(lo, hi); }
+    static VlRandomDomain full(int width) { return VlRandomDomain{0, VL_MASK_Q(width)}; }
+
+    bool empty() const { return m_ranges.empty(); }
+    bool contains(uint64_t value) const {
+        const auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(),
+                                         Range{value, ~0ULL});
+        return it != m_ranges.begin() && value <= std::prev(it)->second;
+    }
+    VlRandomDomain intersect(const VlRandomDomain& other) const {
+        VlRandomDomain out;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < m_ranges.size() && j < other.m_ranges.size()) {
+            const Range& a = m_ranges[i];
+            const Range& b = other.m_ranges[j];
+            out.add(std::max(a.first, b.first), std::min(a.second, b.second));
+            if (a.second < b.second) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        return out;
+    }
+    VlRandomDomain unite(const VlRandomDomain& other) const {
+        VlRandomDomain out = *this;
+        out.m_ranges.insert(out.m_ranges.end(), other.m_ranges.begin(), other.m_ranges.end());
+        out.normalize();
+        return out;
+    }
+    VlRandomDomain complement(int width) const {
+        VlRandomDomain out;
+        uint64_t next = 0;
+        bool done = false;
+        for (const Range& r : m_ranges) {
+            if (r.first > next) out.add(next, r.first - 1);
+            if (r.second == VL_MASK_Q(width)) {
+                done = true;
+                break;
+            }
+            next = r.second + 1;
+        }
+        if (!done) out.add(next, VL_MASK_Q(width));
+        return out;
+    }
+    VlRandomDomain remove(uint64_t value) const {
+        VlRandomDomain out;
+        for (const Range& r : m_ranges) {
+            if (value < r.first || value > r.second) {
+                out.add(r.first, r.second);
+                continue;
+            }
+            if (value > r.first) out.add(r.first, value - 1);
+            if (value < r.second) out.add(value + 1, r.second);
+        }
+        return out;
+    }
+    // Values v with (v + offset) inside [lo, hi], for the part of the set there
+    VlRandomDomain shiftedSlice(uint64_t lo, uint64_t hi, uint64_t offset) const {
+        VlRandomDomain out;
+        for (const Range& r : m_ranges) {
+            const uint64_t a = std::max(r.first, lo);
+            const uint64_t b = std::min(r.second, hi);
+            if (a <= b) out.add(a - offset, b - offset);
+        }
+        out.normalize();
+        return out;
+    }
+    // Flip the sign bit: maps between signed and unsigned (biased) order
+    VlRandomDomain flipSign(int width) const {
+        const uint64_t half = 1ULL << (width - 1);
+        VlRandomDomain out;
+        for (const Range& r : m_ranges) {
+            if (r.first < half) out.add(r.first + half, std::min(r.second, half - 1) + half);
+            if (r.second >= half) out.add(std::max(r.first, half) - half, r.second - half);
+        }
+        out.normalize();
+        return out;
+    }
+    uint64_t sample(VlRNG& rngr) const {
+        // Count of members; wraps to zero only for all 2^64 values
+        uint64_t total = 0;
+        for (const Range& r : m_ranges) total += r.second - r.first + 1;
+        uint64_t pick = VL_RANDOM_RNG_Q(rngr);
+        if (total == 0) return pick;
+        // Redraw from the short tail so every member is equally likely
+        const uint64_t tail = (~0ULL % total + 1) % total;
+        while (pick > ~0ULL - tail) pick = VL_RANDOM_RNG_Q(rngr);
+        pick %= total;
+        for (const Range& r : m_ranges) {
+            const uint64_t span = r.second - r.first;
+            if (pick <= span) return r.first + pick;
+            pick -= span + 1;
+        }
+        return m_ranges.back().second;  // LCOV_EXCL_LINE
+    }
+};
+
+// Conjunction of per-variable domains; an empty map is constant true
+struct VlRandomFastTerm final {
+    bool m_false = false;  // Can never hold
+    std::map<std::string, VlRandomDomain> m_doms;  // Allowed values per variable
+};
+
+// Tiny S-expression tree of one constraint
+struct VlRandomSExpr final {
+    std::string m_atom;  // Atom text, empty for a list
+    std::vector<VlRandomSExpr> m_items;  // List items
+    bool isList() const { return m_atom.empty(); }
+    const std::string& head() const {
+        static const std::string s_empty;
+        return (isList() && !m_items.empty() && !m_items[0].isList()) ? m_items[0].m_atom
+                                                                         : s_empty;
+    }
+    // Parse one expression at cp, leaving cp after it
+    static bool parse(const char*& cp, VlRandomSExpr& exprr) {
+        while (std::isspace(static_cast<unsigned char>(*cp))) ++cp;
+        if (*cp == '(') {
+            ++cp;
+            while (true) {
+                while (std::isspace(static_cast<unsigned char>(*cp))) ++cp;
+                if (*cp == ')') {
+                    ++cp;
+                    return true;
+                }
+                if (!*cp) return false;
+                exprr.m_items.emplace_back();
+                if (!parse(cp, exprr.m_items.back())) return false;
+            }
+        }
+        const char* const startp = cp;
+        while (*cp && *cp != '(' && *cp != ')' && !std::isspace(static_cast<unsigned char>(*cp)))
+            ++cp;
+        exprr.m_atom.assign(startp, cp - startp);
+        return !exprr.m_atom.empty();
+    }
+};
+
+class VlRandomFastPlan final {
+    using VarMap = std::map<std::string, std::shared_ptr<const VlRandomVar>>;
+    // Bit-vector operand: a literal, or a variable possibly zero/sign extended
+    struct Operand final {
+        const VlRandomVar* m_varp = nullptr;  // Variable, nullptr for a literal
+        uint64_t m_value = 0;  // Literal value
+        int m_width = 0;  // Operand width
+        char m_extend = 0;  // 'z'ero or 's'ign extension of the variable, else 0
+    };
+
+    const VarMap& m_vars;  // Variables of the owning randomizer
+    // Text the plan was built from
+    std::vector<std::string> m_hardText;
+    std::vector<std::string> m_softText;
+    size_t m_nvars = 0;
+    bool m_ok = true;  // Every constraint is in the supported subset
+    VlRandomFastTerm m_hard;  // Hard constraints combined
+    std::vector<VlRandomFastTerm> m_softs;  // Soft constraints, lowest priority first
+
+    // METHODS - parsing
+    static bool parseLiteral(const std::string& text, Operand& opr) {
+        if (text.size() < 3 || text[0] != '#') return false;
+        const int digitBits = text[1] == 'b' ? 1 : text[1] == 'x' ? 4 : 0;
+        if (!digitBits) return false;
+        uint64_t value = 0;
+        int width = 0;
+        for (size_t i = 2; i < text.size(); ++i) {
+            const char c = std::tolower(static_cast<unsigned char>(text[i]));
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else {
+                return false;
+            }
+            if (digit >> digitBits) return false;
+            // Leading zeros may widen past 64 bits, other digits may not
+            if (width + digitBits > VL_QUADSIZE && (value >> (VL_QUADSIZE - digitBits)))
+                return false;
+            value = (value << digitBits) | digit;
+            width += digitBits;
+        }
+        if (width > VL_QUADSIZE) return false;
+        opr.m_value = value;
+        opr.m_width = width;
+        return true;
+    }
+    bool parseOperand(const VlRandomSExpr& expr, Operand& opr) const {
+        if (!expr.isList()) {
+            if (parseLiteral(expr.m_atom, opr)) return true;
+            const auto it = m_vars.find(expr.m_atom);
+            if (it == m_vars.end()) return false;
+            opr.m_varp = it->second.get();
+            opr.m_width = opr.m_varp->width();
+            return true;
+        }
+        // (_ bvN W), or ((_ zero_extend N) var)
+        if (expr.m_items.size() != 2 && expr.m_items.size() != 3) return false;
+        if (expr.head() == "_" && expr.m_items.size() == 3) {
+            const std::string& value = expr.m_items[1].m_atom;
+            if (value.size() < 3 || value.compare(0, 2, "bv")) return false;
+            const int width = std::atoi(expr.m_items[2].m_atom.c_str());
+            if (width <= 0 || width > VL_QUADSIZE) return false;
+            char* endp = nullptr;
+            opr.m_value = std::strtoull(value.c_str() + 2, &endp, 10);
+            opr.m_width = width;
+            return *endp == '\0' && !(opr.m_value & ~VL_MASK_Q(width));
+        }
+        const VlRandomSExpr& extend = expr.m_items[0];
+        if (expr.m_items.size() != 2 || extend.head() != "_" || extend.m_items.size() != 3)
+            return false;
+        const std::string& kind = extend.m_items[1].m_atom;
+        if (kind != "zero_extend" && kind != "sign_extend") return false;
+        if (!parseOperand(expr.m_items[1], opr) || !opr.m_varp || opr.m_extend) return false;
+        opr.m_width += std::atoi(extend.m_items[2].m_atom.c_str());
+        opr.m_extend = kind[0];
+        return opr.m_width <= VL_QUADSIZE;
+    }
+
+    // METHODS - term algebra
+    static VlRandomFastTerm constant(bool value) {
+        VlRandomFastTerm term;
+        term.m_false = !value;
+        return term;
+    }
+    bool isConst(const VlRandomFastTerm& term) const {
+        return term.m_false || term.m_doms.empty();
+    }
+    VlRandomFastTerm conj(const VlRandomFastTerm& a, const VlRandomFastTerm& b) const {
+        if (a.m_false || b.m_false) return constant(false);
+        VlRandomFastTerm out = a;
+        for (const auto& itr : b.m_doms) {
+            const auto it = out.m_doms.find(itr.first);
+            if (it == out.m_doms.end()) {
+                out.m_doms.emplace(itr.first, itr.second);
+                continue;
+            }
+            it->second = it->second.intersect(itr.second);
+            if (it->second.empty()) return constant(false);
+        }
+        return out;
+    }
+    bool disj(const VlRandomFastTerm& a, const VlRandomFastTerm& b, VlRandomFastTerm& outr) const {
+        if (a.m_false || (isConst(b) && !b.m_false)) {
+            outr = b;
+        } else if (b.m_false || isConst(a)) {
+            outr = a;
+        } else if (a.m_doms.size() == 1 && b.m_doms.size() == 1
+                   && a.m_doms.begin()->first == b.m_doms.begin()->first) {
+            outr = a;
+            outr.m_doms.begin()->second
+                = a.m_doms.begin()->second.unite(b.m_doms.begin()->second);
+        } else {
+            return false;  // Relates several variables
+        }
+        return true;
+    }
+    bool negate(const VlRandomFastTerm& a, VlRandomFastTerm& outr) const {
+        if (isConst(a)) {
+            outr = constant(a.m_false);
+        } else if (a.m_doms.size() == 1) {
+            const int width = m_vars.at(a.m_doms.begin()->first)->width();
+            outr = VlRandomFastTerm{};
+            VlRandomDomain dom = a.m_doms.begin()->second.complement(width);
+            if (dom.empty()) {
+                outr.m_false = true;
+            } else {
+                outr.m_doms.emplace(a.m_doms.begin()->first, std::move(dom));
+            }
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // METHODS - evaluation
+    static bool isCompare(const std::string& op) {
+        static const std::set<std::string> s_ops{"=",      "bvult", "bvule", "bvugt", "bvuge",
+                                                 "bvslt", "bvsle", "bvsgt", "bvsge"};
+        return s_ops.count(op) != 0;
+    }
+    // Comparison of a variable operand against a literal
+    bool compare(std::string op, Operand a, Operand b, VlRandomFastTerm& outr) const {
+        if (a.m_varp && b.m_varp) return false;
+        const bool isSigned = op.compare(0, 3, "bvs") == 0;
+        const int width = std::max(a.m_width, b.m_width);
+        if (!a.m_varp && !b.m_varp) {
+            uint64_t av = a.m_value;
+            uint64_t bv = b.m_value;
+            if (isSigned) {
+                av ^= 1ULL << (width - 1);
+                bv ^= 1ULL << (width - 1);
+            }
+            const std::string rel = op == "=" ? op : op.substr(3);
+            const bool value = rel == "="    ? av == bv
+                               : rel == "lt" ? av < bv
+                               : rel == "le" ? av <= bv
+                               : rel == "gt" ? av > bv
+                                             : av >= bv;
+            outr = constant(value);
+            return true;
+        }
+        if (!a.m_varp) {
+            // Normalize to (var op literal)
+            std::swap(a, b);
+            if (op != "=") op[3] = op[3] == 'l' ? 'g' : 'l';
+        }
+        const uint64_t top = VL_MASK_Q(width);
+        uint64_t c = b.m_value;
+        if (isSigned) c ^= 1ULL << (width - 1);
+        VlRandomDomain dom;
+        const std::string rel = op == "=" ? op : op.substr(3);
+        if (rel == "=") {
+            dom = VlRandomDomain{c, c};
+        } else if (rel == "lt") {
+            if (c) dom = VlRandomDomain{0, c - 1};
+        } else if (rel == "le") {
+            dom = VlRandomDomain{0, c};
+        } else if (rel == "gt") {
+            if (c != top) dom = VlRandomDomain{c + 1, top};
+        } else {
+            dom = VlRandomDomain{c, top};
+        }
+        if (isSigned) dom = dom.flipSign(width);
+        // Values of the extended operand back to values of the variable
+        const int varWidth = a.m_varp->width();
+        if (a.m_extend == 's' && varWidth < width) {
+            const uint64_t negBase = top - VL_MASK_Q(varWidth - 1);  // 2^W - 2^(w-1)
+            const uint64_t offset = top - VL_MASK_Q(varWidth);  // 2^W - 2^w
+            dom = dom.shiftedSlice(0, VL_MASK_Q(varWidth - 1), 0)
+                      .unite(dom.shiftedSlice(negBase, top, offset));
+        } else if (varWidth < width) {
+            dom = dom.intersect(VlRandomDomain::full(varWidth));
+        }
+        outr = VlRandomFastTerm{};
+        if (dom.empty()) {
+            outr.m_false = true;
+        } else {
+            outr.m_doms.emplace(a.m_varp->name(), std::move(dom));
+        }
+        return true;
+    }
+    // Expression of Bool sort
+    bool evalBool(const VlRandomSExpr& expr, VlRandomFastTerm& outr) const {
+        if (!expr.isList()) {
+            if (expr.m_atom != "true" && expr.m_atom != "false") return false;
+            outr = constant(expr.m_atom == "true");
+            return true;
+        }
+        const std::string& op = expr.head();
+        const size_t nargs = expr.m_items.size() - 1;
+        if (op == "__Vbool" && nargs == 1) return evalBits(expr.m_items[1], outr);
+        if (op == "not" && nargs == 1) {
+            VlRandomFastTerm term;
+            return evalBool(expr.m_items[1], term) && negate(term, outr);
+        }
+        if (op == "and" || op == "or") {
+            outr = constant(op == "and");
+            for (size_t i = 1; i <= nargs; ++i) {
+                VlRandomFastTerm term;
+                if (!evalBool(expr.m_items[i], term)) return false;
+                if (op == "and") {
+                    outr = conj(outr, term);
+                } else if (!disj(outr, term, outr)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (op == "=>" && nargs == 2) {
+            VlRandomFastTerm cond;
+            VlRandomFastTerm notCond;
+            VlRandomFastTerm then;
+            return evalBool(expr.m_items[1], cond) && negate(cond, notCond)
+                   && evalBool(expr.m_items[2], then) && disj(notCond, then, outr);
+        }
+        if (nargs != 2 || !isCompare(op)) return false;
+        Operand a;
+        Operand b;
+        if (parseOperand(expr.m_items[1], a) && parseOperand(expr.m_items[2], b)) {
+            return compare(op, a, b, outr);
+        }
+        if (op != "=") return false;
+        // Equality of a one-bit result against a literal bit
+        for (int side = 1; side <= 2; ++side) {
+            Operand lit;
+            if (expr.m_items[side].isList() || !parseLiteral(expr.m_items[side].m_atom, lit)
+                || lit.m_width != 1)
+                continue;
+            VlRandomFastTerm term;
+            if (!evalBits(expr.m_items[3 - side], term)) return false;
+            if (lit.m_value) {
+                outr = term;
+                return true;
+            }
+            return negate(term, outr);
+        }
+        return false;
+    }
+    // Expression of one-bit bit-vector sort, as emitted for a constraint
+    bool evalBits(const VlRandomSExpr& expr, VlRandomFastTerm& outr) const {
+        if (!expr.isList()) {
+            Operand opr;
+            if (!parseOperand(expr, opr) || opr.m_width != 1) return false;
+            if (!opr.m_varp) {
+                outr = constant(opr.m_value);
+                return true;
+            }
+            outr = VlRandomFastTerm{};
+            outr.m_doms.emplace(opr.m_varp->name(), VlRandomDomain{1, 1});
+            return true;
+        }
+        const std::string& op = expr.head();
+        const size_t nargs = expr.m_items.size() - 1;
+        if (op == "__Vbv" && nargs == 1) return evalBool(expr.m_items[1], outr);
+        if (op == "bvnot" && nargs == 1) {
+            VlRandomFastTerm term;
+            return evalBits(expr.m_items[1], term) && negate(term, outr);
+        }
+        if ((op == "bvand" || op == "bvor") && nargs >= 1) {
+            outr = constant(op == "bvand");
+            for (size_t i = 1; i <= nargs; ++i) {
+                VlRandomFastTerm term;
+                if (!evalBits(expr.m_items[i], term)) return false;
+                if (op == "bvand") {
+                    outr = conj(outr, term);
+                } else if (!disj(outr, term, outr)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+    bool evalConstraint(const std::string& text, VlRandomFastTerm& outr) const {
+        VlRandomSExpr expr;
+        const char* cp = text.c_str();
+        if (!VlRandomSExpr::parse(cp, expr)) return false;
+        while (std::isspace(static_cast<unsigned char>(*cp))) ++cp;
+        return !*cp && evalBits(expr, outr);
+    }
+
+public:
+    // CONSTRUCTORS
+    VlRandomFastPlan(const VarMap& vars, const std::vector<std::string>& hard,
+                     const std::vector<std::string>& soft)
+        : m_vars{vars}
+        , m_hardText{hard}
+        , m_softText{soft}
+        , m_nvars{vars.size()} {
+        for (const auto& var : m_vars) {
+            if (var.second->dimension() > 0 || var.second->width() > VL_QUADSIZE) {
+                m_ok = false;
+                return;
+            }
+        }
+        for (const std::string& text : hard) {
+            VlRandomFastTerm term;
+            if (!evalConstraint(text, term)) {
+                m_ok = false;
+                return;
+            }
+            m_hard = conj(m_hard, term);
+        }
+        for (const std::string& text : soft) {
+            m_softs.emplace_back();
+            if (!evalConstraint(text, m_softs.back())) {
+                m_ok = false;
+                return;
+            }
+        }
+    }
+
+    // METHODS
+    bool matches(const VarMap& vars, const std::vector<std::string>& hard,
+                 const std::vector<std::string>& soft) const {
+        return &vars == &m_vars && vars.size() == m_nvars && hard == m_hardText
+               && soft == m_softText;
+    }
+    bool ok() const { return m_ok; }
+    bool sat() const { return !m_hard.m_false; }
+    // Allowed values of a variable under the hard constraints
+    VlRandomDomain hardDomain(const std::string& name, int width) const {
+        const auto it = m_hard.m_doms.find(name);
+        return it == m_hard.m_doms.end() ? VlRandomDomain::full(width) : it->second;
+    }
+    // Narrow domsr by term; false and unchanged if that leaves no value
+    bool apply(std::map<std::string, VlRandomDomain>& domsr,
+               const VlRandomFastTerm& term) const {
+        if (term.m_false) return false;
+        std::vector<std::pair<VlRandomDomain*, VlRandomDomain>> updates;
+        for (const auto& itr : term.m_doms) {
+            VlRandomDomain& dom = domsr.at(itr.first);
+            VlRandomDomain narrowed = dom.intersect(itr.second);
+            if (narrowed.empty()) return false;
+            updates.emplace_back(&dom, std::move(narrowed));
+        }
+        for (auto& update : updates) *update.first = std::move(update.second);
+        return true;
+    }
+    // Keep every soft constraint if together compatible, else the highest
+    // priority (last declared) first, dropping ones that conflict
+    void relaxSoft(std::map<std::string, VlRandomDomain>& domsr) const {
+        std::map<std::string, VlRandomDomain> all = domsr;
+        bool allOk = true;
+        for (const VlRandomFastTerm& term : m_softs) {
+            if (!apply(all, term)) {
+                allOk = false;
+                break;
+            }
+        }
+        if (allOk) {
+            domsr = std::move(all);
+            return;
+        }
+        for (auto it = m_softs.rbegin(); it != m_softs.rend(); ++it) apply(domsr, *it);
+    }
+};
+
 //======================================================================
 // VlRandomizer:: Methods
 
@@ -472,6 +1205,18 @@ static uint64_t readVarValueU64(const void* datap, int width) {
     return 0;
 }
 
+static void writeVarValueU64(void* datap, int width, uint64_t value) {
+    if (width <= VL_BYTESIZE) {
+        *static_cast<CData*>(datap) = static_cast<CData>(value);
+    } else if (width <= VL_SHORTSIZE) {
+        *static_cast<SData*>(datap) = static_cast<SData>(value);
+    } else if (width <= VL_IDATASIZE) {
+        *static_cast<IData*>(datap) = static_cast<IData>(value);
+    } else {
+        *static_cast<QData*>(datap) = value;
+    }
+}
+
 void VlRandomizer::recordRandcValues() {
     for (const auto& name : m_randcVarNames) {
         const auto varIt = m_vars.find(name);
@@ -503,8 +1248,12 @@ bool VlRandomizer::nextRandomize(VlRNG& rngr, bool checkOnly) {
     }
 
     // Pinned vars make phase ordering moot; skip phased path in check-only.
+    // Solve-before has no effect on independent variables, so the fast path
+    // goes first either way.
     bool result;
-    if (!m_checkOnly && !m_solveBefore.empty()) {
+    if (uniqueExprs.empty() && nextFast(rngr, result)) {
+        // Solved in-process
+    } else if (!m_checkOnly && !m_solveBefore.empty()) {
         result = nextPhased(rngr, uniqueExprs);
     } else {
         result = nextFlat(rngr, uniqueExprs);
@@ -513,6 +1262,59 @@ bool VlRandomizer::nextRandomize(VlRNG& rngr, bool checkOnly) {
     return result;
 }
 
+bool VlRandomizer::nextFast(VlRNG& rngr, bool& resultr) {
+    const VerilatedContext* const contextp = Verilated::threadContextp();
+    // A solver log is expected to record every call
+    if (!contextp->solverFast() || !contextp->solverLogFilename().empty()) return false;
+    if (!m_fastPlanp || !m_fastPlanp->matches(m_vars, m_constraints, m_softConstraints)) {
+        m_fastPlanp
+            = std::make_shared<const VlRandomFastPlan>(m_vars, m_constraints, m_softConstraints);
+    }
+    const VlRandomFastPlan& plan = *m_fastPlanp;
+    if (!plan.ok()) return false;
+    if (m_checkOnly) {
+        // Softs never make a pinned assignment unsatisfiable
+        resultr = plan.sat();
+        for (const auto& var : m_vars) {
+            if (!resultr) break;
+            const int width = var.second->width();
+            resultr = plan.hardDomain(var.first, width)
+                          .contains(readVarValueU64(var.second->datap(0), width));
+        }
+        return true;
+    }
+    // Unsatisfiable sets go to the solver, which reports the conflicting constraints
+    if (!plan.sat()) return false;
+
+    std::map<std::string, VlRandomDomain> doms;
+    for (const auto& var : m_vars) {
+        doms.emplace(var.first, plan.hardDomain(var.first, var.second->width()));
+    }
+    // Randc exclusions as in nextFlat: a new cycle once any variable runs dry
+    bool exhausted = false;
+    for (const auto& usedIt : m_randcUsedValues) {
+        VlRandomDomain& dom = doms.at(usedIt.first);
+        for (const uint64_t value : usedIt.second) dom = dom.remove(value);
+        exhausted |= dom.empty();
+    }
+    if (exhausted) {
+        m_randcUsedValues.clear();
+        for (auto& itr : doms) {
+            itr.second = plan.hardDomain(itr.first, m_vars.at(itr.first)->width());
+        }
+    }
+    plan.relaxSoft(doms);
+
+    for (const auto& var : m_vars) {
+        const uint64_t value = doms.at(var.first).sample(rngr);
+        if (skipWriteBack(var.first, *var.second)) continue;
+        writeVarValueU64(var.second->datap(0), var.second->width(), value);
+    }
+    recordRandcValues();
+    resultr = true;
+    return true;
+}
+
 std::vector<std::string> VlRandomizer::buildUniqueExprs() const {
     std::vector<std::string> exprs;
     if (m_unique_arrays.empty()) return exprs;
@@ -540,7 +1342,7 @@ void VlRandomizer::emitDefines(std::ostream& os) const {
     os << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
 }
 
-void VlRandomizer::emitDeclares(std::ostream& os, bool pinCurrent) const {
+void VlRandomizer::emitDeclares(std::ostream& os) const {
     for (const auto& var : m_vars) {
         if (var.second->dimension() > 0) {
             auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
@@ -549,16 +1351,69 @@ void VlRandomizer::emitDeclares(std::ostream& os, bool pinCurrent) const {
         os << "(declare-fun " << var.first << " () ";
         var.second->emitType(os);
         os << ")\n";
-        // Pin each var to its current value
-        if (pinCurrent) {
-            assert(var.second->dimension() == 0);
-            os << "(assert (= " << var.first << ' ';
-            var.second->emitConcreteValue(os);
-            os << "))\n";
-        }
     }
 }
 
+void VlRandomizer::emitPins(std::ostream& os) const {
+    // Pin each var to its current value
+    for (const auto& var : m_vars) {
+        assert(var.second->dimension() == 0);
+        os << "(assert (= " << var.first << ' ';
+        var.second->emitConcreteValue(os);
+        os << "))\n";
+    }
+}
+
+std::string VlRandomizer::sessionDeclares() const {
+    std::ostringstream os;
+    os << "(set-option :produce-models true)\n";
+    // Lets the scalar pin path learn which free-bit assumptions conflict.
+    os << "(set-option :produce-unsat-assumptions true)\n";
+    os << "(set-logic QF_ABV)\n";
+    emitDefines(os);
+    emitDeclares(os);
+    if (!hasArrayVars()) emitPinLiterals(os);
+    return os.str();
+}
+
+void VlRandomizer::syncSession(VlRProcess& os, const std::string& declares,
+                               const std::vector<std::string>& uniqueExprs) const {
+    // The declarations are the same for every call on a class, and usually
+    // for its other instances, so they are sent only when the context differs
+    if (os.sessionDeclares() != declares) {
+        if (!os.sessionDeclares().empty()) os.reset();
+        os << declares;
+        os.sessionDeclares() = declares;
+    }
+
+    // Each hard constraint sits on its own push level. Keep the bottom run
+    // still wanted, pop the rest, and push what is missing; popped ones come
+    // back first so constraints whose state values change drift to the top.
+    std::map<std::string, int> wanted;
+    for (const std::string& constraint : m_constraints) ++wanted[constraint];
+    for (const std::string& extra : uniqueExprs) ++wanted[extra];
+    std::vector<std::string>& asserted = os.sessionAsserted();
+    size_t keep = 0;
+    for (; keep < asserted.size(); ++keep) {
+        const auto it = wanted.find(asserted[keep]);
+        if (it == wanted.end() || it->second == 0) break;
+        --it->second;
+    }
+    std::vector<std::string> popped{asserted.begin() + keep, asserted.end()};
+    if (!popped.empty()) os << "(pop " << popped.size() << ")\n";
+    asserted.resize(keep);
+    const auto pushWanted = [&](const std::string& constraint) {
+        int& countr = wanted[constraint];
+        if (countr == 0) return;
+        --countr;
+        os << "(push 1)\n(assert (= #b1 " << constraint << "))\n";
+        asserted.push_back(constraint);
+    };
+    for (const std::string& constraint : popped) pushWanted(constraint);
+    for (const std::string& constraint : m_constraints) pushWanted(constraint);
+    for (const std::string& extra : uniqueExprs) pushWanted(extra);
+}
+
 void VlRandomizer::emitAsserts(std::ostream& os, const std::vector<std::string>& extras,
                                bool named) const {
     int j = 0;
@@ -579,30 +1434,37 @@ void VlRandomizer::emitAsserts(std::ostream& os, const std::vector<std::string>&
 }
 
 bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueExprs) {
+    const std::string declares = sessionDeclares();
     // Randc retry: if unsat due to randc exhaustion, clear history and retry once
     const bool hasRandc = !m_randcVarNames.empty();
+    // Solutions solved ahead need the pin literals, and would skip randc cycling
+    const int batch = Verilated::threadContextp()->solverBatch();
+    std::string aheadKey;
+    if (batch > 1 && !m_checkOnly && !hasRandc && !hasArrayVars()) {
+        aheadKey = solvedAheadKey(declares, uniqueExprs);
+        if (takeSolvedAhead(aheadKey)) return true;
+    }
     for (int attempt = 0; attempt < (hasRandc ? 2 : 1); ++attempt) {
-        std::iostream& os = getSolver();
+        const VlRSolverLease lease{declares};
+        VlRProcess& os = lease.proc();
         if (!os) return false;
 
-        os << "(set-option :produce-models true)\n";
-        // Lets the scalar pin path learn which free-bit assumptions conflict.
-        os << "(set-option :produce-unsat-assumptions true)\n";
-        os << "(set-logic QF_ABV)\n";
-        emitDefines(os);
-        emitDeclares(os, m_checkOnly);
-        emitAsserts(os, uniqueExprs, false);
+        // Declarations and hard constraints persist between calls; everything
+        // specific to this call goes in one more level popped at the end
+        syncSession(os, declares, uniqueExprs);
+        os << "(push 1)\n";
+        if (m_checkOnly) emitPins(os);
 
         // randc exclusions vs. a pinned current value would make every check
         // trivially UNSAT after the first cycle.
         if (!m_checkOnly) emitRandcExclusions(os);
 
-        relaxSoftConstraints(os);
+        const int softLevels = relaxSoftConstraints(os);
         os << "(check-sat)\n";
         const bool sat = parseSolution(os);
 
         if (!sat) {
-            os << "(reset)\n";
+            os.reset();
             // If randc vars have used values, this may be cycle exhaustion - retry
             if (hasRandc && !m_randcUsedValues.empty() && attempt == 0) {
                 m_randcUsedValues.clear();
@@ -614,7 +1476,7 @@ bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueE
             if (m_checkOnly) return false;
             // Genuine unsat: report via unsat-core
             reportUnsatSetup(os, uniqueExprs);
-            os << "(reset)\n";
+            os.reset();
             return false;
         }
 
@@ -622,49 +1484,64 @@ bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueE
             solveDiversity(rngr, os);
             // Check-only must not advance randc cycle state.
             recordRandcValues();
+            if (!aheadKey.empty()) solveAhead(rngr, os, aheadKey, batch - 1);
         }
 
-        os << "(reset)\n";
+        os << "(pop " << (softLevels + 1) << ")\n";
         return true;
     }
     return false;  // Should not reach here
 }
 
-void VlRandomizer::solveDiversity(VlRNG& rngr, std::iostream& os) {
-    bool hasArray = false;
+bool VlRandomizer::hasArrayVars() const {
     for (const auto& var : m_vars) {
-        if (var.second->dimension() > 0) {
-            hasArray = true;
-            break;
-        }
-    }
-    if (hasArray) {
-        solveDiversityXor(rngr, os);
-    } else {
-        solveDiversityPins(rngr, os);
+        if (var.second->dimension() > 0) return true;
     }
+    return false;
 }
 
-void VlRandomizer::solveDiversityPins(VlRNG& rngr, std::iostream& os) {
-    // Tie each free bit to a random target via an assumption literal;
-    // drop one conflicting literal per round until compatible
+void VlRandomizer::emitPinLiterals(std::ostream& os) const {
+    // a<N> is true when free bit N is set; declared once per session
     int npins = 0;
     for (const auto& var : m_vars) {
         const int w = var.second->totalWidth();
         for (int b = 0; b < w; ++b) {
-            const bool target = (VL_RANDOM_RNG_I(rngr) & 1);
             os << "(declare-fun a" << npins << " () Bool)\n";
             os << "(assert (= a" << npins << " (=";
             var.second->emitExtract(os, b);
-            os << " #b" << (target ? '1' : '0') << ")))\n";
+            os << " #b1)))\n";
             ++npins;
         }
     }
+}
+
+void VlRandomizer::solveDiversity(VlRNG& rngr, std::iostream& os) {
+    if (hasArrayVars()) {
+        solveDiversityXor(rngr, os);
+    } else {
+        solveDiversityPins(rngr, os);
+    }
+}
+
+void VlRandomizer::solveDiversityPins(VlRNG& rngr, std::iostream& os) {
+    // Assume each free bit's literal at a random polarity;
+    // drop one conflicting literal per round until compatible
+    std::vector<bool> targets;
+    for (const auto& var : m_vars) {
+        const int w = var.second->totalWidth();
+        for (int b = 0; b < w; ++b) targets.push_back(VL_RANDOM_RNG_I(rngr) & 1);
+    }
+    const int npins = static_cast<int>(targets.size());
     std::vector<bool> dropped(npins, false);
     for (int round = 0; round <= npins; ++round) {
         os << "(check-sat-assuming (";
         for (int k = 0; k < npins; ++k) {
-            if (!dropped[k]) os << " a" << k;
+            if (dropped[k]) continue;
+            if (targets[k]) {
+                os << " a" << k;
+            } else {
+                os << " (not a" << k << ')';
+            }
         }
         os << "))\n";
         if (parseSolution(os)) return;
@@ -691,27 +1568,128 @@ void VlRandomizer::solveDiversityXor(VlRNG& rngr, std::iostream& os) {
     }
 }
 
+std::string VlRandomizer::solvedAheadKey(const std::string& declares,
+                                         const std::vector<std::string>& uniqueExprs) const {
+    std::string key = declares;
+    for (const std::string& constraint : m_constraints) key += constraint + '\n';
+    for (const std::string& extra : uniqueExprs) key += extra + '\n';
+    key += "; soft\n";
+    for (const std::string& constraint : m_softConstraints) key += constraint + '\n';
+    return key;
+}
+
+bool VlRandomizer::takeSolvedAhead(const std::string& key) {
+    VlRSolutionCache::Solution solution;
+    if (!VlRSolutionCache::instance().take(key, solution)) return false;
+    for (const auto& value : solution) {
+        const auto it = m_vars.find(value.first);
+        if (it == m_vars.end() || skipWriteBack(value.first, *it->second)) continue;
+        it->second->set("", value.second);
+    }
+    return true;
+}
+
+void VlRandomizer::solveAhead(VlRNG& rngr, std::iostream& os, const std::string& key,
+                              int count) {
+    // Solve count more times in the same context as the solution just
+    // written back, keeping a few queries in flight ahead of reading their
+    // replies. Each assumes its own random polarity for every free bit;
+    // queries that come back unsat retry on a random half of their
+    // assumptions, up to a few rounds, instead of dropping one conflicting
+    // literal per round trip.
+    struct Query final {
+        std::vector<int> m_lits;  // Assumed pins, ~pin if negated
+        int m_round;  // Retries so far
+    };
+    // Bounds the replies the solver may have to buffer in the pipe while we
+    // write, as neither side reads while its write blocks
+    static constexpr size_t MAX_IN_FLIGHT = 8;
+    static constexpr int MAX_ROUNDS = 4;
+    std::ostringstream getValue;
+    getValue << "(get-value (";
+    for (const auto& var : m_vars) var.second->emitGetValue(getValue);
+    getValue << "))\n";
+    int npins = 0;
+    for (const auto& var : m_vars) npins += var.second->totalWidth();
+
+    std::deque<Query> unsent;
+    for (int i = 0; i < count; ++i) {
+        Query query{{}, 0};
+        for (int k = 0; k < npins; ++k) {
+            query.m_lits.push_back((VL_RANDOM_RNG_I(rngr) & 1) ? k : ~k);
+        }
+        unsent.push_back(std::move(query));
+    }
+    std::deque<Query> inFlight;
+    std::vector<VlRSolutionCache::Solution> solutions;
+    while (!unsent.empty() || !inFlight.empty()) {
+        while (!unsent.empty() && inFlight.size() < MAX_IN_FLIGHT) {
+            os << "(check-sat-assuming (";
+            for (const int lit : unsent.front().m_lits) {
+                if (lit >= 0) {
+                    os << " a" << lit;
+                } else {
+                    os << " (not a" << ~lit << ')';
+                }
+            }
+            os << "))\n" << getValue.str();
+            inFlight.push_back(std::move(unsent.front()));
+            unsent.pop_front();
+        }
+        // Every query has two replies; get-value after unsat replies with an error
+        const Query query = std::move(inFlight.front());
+        inFlight.pop_front();
+        const std::string status = readReply(os);
+        const std::string values = readReply(os);
+        if (status == "unsat") {
+            if (query.m_round + 1 >= MAX_ROUNDS) continue;
+            Query half{{}, query.m_round + 1};
+            for (const int lit : query.m_lits) {
+                if (VL_RANDOM_RNG_I(rngr) & 1) half.m_lits.push_back(lit);
+            }
+            unsent.push_back(std::move(half));
+            continue;
+        }
+        VlRandomSExpr reply;
+        const char* cp = values.c_str();
+        if (status != "sat" || !VlRandomSExpr::parse(cp, reply)) continue;
+        VlRSolutionCache::Solution solution;
+        for (const VlRandomSExpr& item : reply.m_items) {
+            if (item.m_items.size() != 2 || item.m_items[1].isList()) break;
+            solution.emplace_back(item.m_items[0].m_atom, item.m_items[1].m_atom);
+        }
+        if (solution.size() == m_vars.size()) solutions.push_back(std::move(solution));
+    }
+    VlRSolutionCache::instance().put(key, std::move(solutions));
+}
+
 bool VlRandomizer::checkSat(std::iostream& os) {
     std::string result;
     do { std::getline(os, result); } while (result.empty());
     return result == "sat";
 }
 
-void VlRandomizer::relaxSoftConstraints(std::iostream& os) {
+int VlRandomizer::relaxSoftConstraints(std::iostream& os) {
     // Re-add softs highest-priority first, dropping incompatible ones.
     const size_t nSoft = m_softConstraints.size();
-    if (nSoft == 0) return;
+    if (nSoft == 0) return 0;
     os << "(push 1)\n";
     for (const auto& s : m_softConstraints) os << "(assert (= #b1 " << s << "))\n";
     os << "(check-sat)\n";
-    if (checkSat(os)) return;
+    if (checkSat(os)) return 1;
     os << "(pop 1)\n";
+    int levels = 0;
     for (auto it = m_softConstraints.rbegin(); it != m_softConstraints.rend(); ++it) {
         os << "(push 1)\n";
         os << "(assert (= #b1 " << *it << "))\n";
         os << "(check-sat)\n";
-        if (!checkSat(os)) os << "(pop 1)\n";
+        if (checkSat(os)) {
+            ++levels;
+        } else {
+            os << "(pop 1)\n";
+        }
     }
+    return levels;
 }
 
 // Every complete run of digits in the reply, in order
@@ -734,7 +1712,8 @@ std::vector<int> VlRandomizer::readUnsatAssumptions(std::iostream& os) {
     os << "(get-unsat-assumptions)\n";
     std::string line;
     do { std::getline(os, line); } while (line.empty());
-    // The response lists only "a<N>" literals; collect each full integer run.
+    // The response lists only "a<N>" or "(not a<N>)" literals; collect each
+    // full integer run.
     return scanIntRuns(line);
 }
 
@@ -744,7 +1723,7 @@ void VlRandomizer::reportUnsatSetup(std::iostream& os,
     os << "(set-option :produce-unsat-cores true)\n";
     os << "(set-logic QF_ABV)\n";
     emitDefines(os);
-    emitDeclares(os, false);
+    emitDeclares(os);
     emitAsserts(os, uniqueExprs, true);
     os << "(check-sat)\n";
     std::string status;
@@ -837,14 +1816,7 @@ bool VlRandomizer::parseSolution(std::iostream& os) {
         const auto it = m_vars.find(name);
         if (it == m_vars.end()) continue;
         const VlRandomVar& varr = *it->second;
-        if (!varr.randModeIdxNone()) {
-            // Static rand vars have their rand_mode in a class-package shared queue,
-            // not the per-instance one.
-            const VlQueue<CData>* const modep
-                = m_staticVars.count(name) ? m_static_randmodep : m_randmodep;
-            if (modep && !modep->at(varr.randModeIdx())) continue;
-        }
-        if (m_disabledVars.count(name)) continue;
+        if (skipWriteBack(name, varr)) continue;
         if (!indices.empty()) {
             std::ostringstream oss;
             oss << varr.name();
@@ -887,6 +1859,17 @@ bool VlRandomizer::parseSolution(std::iostream& os) {
     return true;
 }
 
+bool VlRandomizer::skipWriteBack(const std::string& name, const VlRandomVar& var) const {
+    if (!var.randModeIdxNone()) {
+        // Static rand vars have their rand_mode in a class-package shared queue,
+        // not the per-instance one.
+        const VlQueue<CData>* const modep
+            = m_staticVars.count(name) ? m_static_randmodep : m_randmodep;
+        if (modep && !modep->at(var.randModeIdx())) return true;
+    }
+    return m_disabledVars.count(name) != 0;
+}
+
 void VlRandomizer::hard(std::string&& constraint, const char* filename, uint32_t linenum,
                         const char* source) {
     m_constraints.emplace_back(std::move(constraint));
@@ -926,6 +1909,7 @@ void VlRandomizer::clearConstraints() {
 }
 
 void VlRandomizer::clearAll() {
+    m_fastPlanp.reset();
     m_constraints.clear();
     m_softConstraints.clear();
     m_vars.clear();
@@ -1011,13 +1995,16 @@ bool VlRandomizer::solvePhases(VlRNG& rngr, const std::vector<std::vector<std::s
     for (size_t phase = 0; phase < layers.size(); phase++) {
         const bool isFinalPhase = (phase == layers.size() - 1);
 
-        std::iostream& os = getSolver();
+        const VlRSolverLease lease{""};
+        VlRProcess& os = lease.proc();
         if (!os) return false;
+        // Phases build their own context from scratch
+        if (!os.sessionDeclares().empty()) os.reset();
 
         os << "(set-option :produce-models true)\n";
         os << "(set-logic " << logicp << ")\n";
         emitDefines(os);
-        emitDeclares(os, false);
+        emitDeclares(os);
 
         for (const auto& entry : solvedValues) {
             os << "(assert (= " << entry.first << " " << entry.second << "))\n";
@@ -1038,23 +2025,23 @@ bool VlRandomizer::solvePhases(VlRNG& rngr, const std::vector<std::vector<std::s
             const bool sat = parseSolution(os);
             if (!sat) {
                 if (!m_randcVarNames.empty()) m_randcUsedValues.clear();
-                os << "(reset)\n";
+                os.reset();
                 return false;
             }
             // Record solved randc values for future exclusion
             recordRandcValues();
             solveDiversityXor(rngr, os);
-            os << "(reset)\n";
+            os.reset();
         } else {
             if (!checkSat(os)) {
-                os << "(reset)\n";
+                os.reset();
                 return false;
             }
             if (!solvePhaseValues(os, rngr, layers[phase], solvedValues)) {
-                os << "(reset)\n";
+                os.reset();
                 return false;
             }
-            os << "(reset)\n";
+            os.reset();
         }
     }
 
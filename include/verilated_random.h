@@ -230,6 +230,9 @@ public:
     }
 };
 
+class VlRandomFastPlan;
+class VlRProcess;
+
 //=============================================================================
 // Object holding constraints and variable references.
 class VlRandomizer VL_NOT_FINAL {
@@ -254,13 +257,16 @@ class VlRandomizer VL_NOT_FINAL {
     std::vector<std::pair<std::string, std::string>>
         m_solveBefore;  // Solve-before ordering pairs (beforeVar, afterVar)
     bool m_checkOnly = false;  // Set for randomize(null)
+    // In-process domains of the last constraint set, rebuilt when it changes
+    std::shared_ptr<const VlRandomFastPlan> m_fastPlanp;
 
     // PRIVATE METHODS
     void randomConstraint(std::ostream& os, VlRNG& rngr, int bits);
     bool parseSolution(std::iostream& os);
     bool checkSat(std::iostream& os);
     // Assert the maximal compatible soft-constraint set onto the open session.
-    void relaxSoftConstraints(std::iostream& os);
+    // Returns the number of push levels left for them.
+    int relaxSoftConstraints(std::iostream& os);
     // Indices of the "a<N>" literals named by (get-unsat-assumptions).
     std::vector<int> readUnsatAssumptions(std::iostream& os);
     void reportUnsatSetup(std::iostream& os, const std::vector<std::string>& uniqueExprs);
@@ -269,15 +275,36 @@ class VlRandomizer VL_NOT_FINAL {
     void recordRandcValues();  // Record solved randc values for future exclusion
     size_t hashConstraints(const std::vector<std::string>& extras) const;
     bool nextRandomize(VlRNG& rngr, bool checkOnly);
+    // Solve without the solver when every constraint bounds one scalar variable.
+    // Returns false if the solver must be used, else the result in resultr.
+    bool nextFast(VlRNG& rngr, bool& resultr);
+    // Solved value must not be written back (rand_mode off or disabled)
+    bool skipWriteBack(const std::string& name, const VlRandomVar& var) const;
     // "(distinct ...)" expression per unique-constrained array
     std::vector<std::string> buildUniqueExprs() const;
     void emitDefines(std::ostream& os) const;
-    void emitDeclares(std::ostream& os, bool pinCurrent) const;
+    void emitDeclares(std::ostream& os) const;
+    void emitPins(std::ostream& os) const;  // Assert every var equals its current value
+    // Logic, defines and declarations opening a solver session
+    std::string sessionDeclares() const;
+    // Bring the solver's persistent context to these declarations and hard
+    // constraints, sending only what differs from the previous call
+    void syncSession(VlRProcess& os, const std::string& declares,
+                     const std::vector<std::string>& uniqueExprs) const;
     void emitAsserts(std::ostream& os, const std::vector<std::string>& extras, bool named) const;
     bool nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueExprs);
+    bool hasArrayVars() const;
+    // Per-bit literals the scalar diversity rounds assume
+    void emitPinLiterals(std::ostream& os) const;
     void solveDiversity(VlRNG& rngr, std::iostream& os);
     void solveDiversityPins(VlRNG& rngr, std::iostream& os);
     void solveDiversityXor(VlRNG& rngr, std::iostream& os);
+    // Complete constraint text keying solutions solved ahead (+solver+batch)
+    std::string solvedAheadKey(const std::string& declares,
+                               const std::vector<std::string>& uniqueExprs) const;
+    bool takeSolvedAhead(const std::string& key);  // Write back a cached solution
+    // Pipeline count more diverse solves of the current context into the cache
+    void solveAhead(VlRNG& rngr, std::iostream& os, const std::string& key, int count);
     // Layers of solve...before variables in dependency order
     bool buildSolveLayers(std::vector<std::vector<std::string>>& layersr);
     const char* phasedLogic() const;
@@ -317,6 +317,7 @@ void VerilatedSaif::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     if (!isOpen()) return;
 
+    Super::flushBase();
     finalizeSaifFileContents();
     clearCurrentlyCollectedData();
 
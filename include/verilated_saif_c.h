@@ -214,6 +214,10 @@ template <>
 void VerilatedSaif::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedSaif::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedSaif::Super::triggerHistory(uint64_t dumps);
+template <>
+void VerilatedSaif::Super::trigger();
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -296,6 +300,12 @@ public:
     void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    // Hold back at least the last 'dumps' calls to dump() in memory, and
+    // write them only on trigger(), or on $stop, $fatal or a failed assertion.
+    // Zero stops holding back, discarding the dumps held so far.
+    void triggerHistory(uint64_t dumps) VL_MT_SAFE { m_sptrace.triggerHistory(dumps); }
+    // Write the held back dumps, then continue writing each dump as usual
+    void trigger() VL_MT_SAFE { m_sptrace.trigger(); }
 
     // METHODS - Internal/backward compatible
     // \protectedsection
@@ -30,14 +30,26 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <condition_variable>
+#include <deque>
 #include <fcntl.h>
+#include <map>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
 
 // clang-format off
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
 # include <io.h>
+# define VL_SAVE_LSEEK ::_lseeki64
+// _chsize_s returns an errno_t rather than -1 with errno set
+# define VL_SAVE_TRUNCATE(fd, size) ((errno = ::_chsize_s((fd), (size))) ? -1 : 0)
 #else
 # include <unistd.h>
+# define VL_SAVE_LSEEK ::lseek
+# define VL_SAVE_TRUNCATE(fd, size) ::ftruncate((fd), (size))
 #endif
 
 #ifndef O_LARGEFILE  // WIN32 headers omit this
@@ -56,6 +68,154 @@
 static const char* const VLTSAVE_HEADER_STR = "verilatorsave02\n";
 // Value of last bytes of each file (must be multiple of 8 bytes)
 static const char* const VLTSAVE_TRAILER_STR = "vltsaved";
+// Value of first and last bytes of each compressed file (must be multiple of 8 bytes)
+static const char* const VLTSAVE_CHUNKED_HEADER_STR = "verilatorsavez1\n";
+static const char* const VLTSAVE_CHUNKED_TRAILER_STR = "vltsavez";
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// Compressed save file format
+//
+// A compressed save file holds the same byte stream as an uncompressed save,
+// split into chunks that are compressed independently so they may be
+// decompressed in parallel:
+//
+//   VLTSAVE_CHUNKED_HEADER_STR
+//   Chunk data, each compressed or stored as is
+//   Index, a VlSaveChunk per chunk
+//   uint64_t number of chunks
+//   uint64_t file offset of index
+//   VLTSAVE_CHUNKED_TRAILER_STR
+//
+// Integers are in the native byte order, as in the rest of the save format.
+// Chunks are compressed with an LZ77 variant using the LZ4 block encoding;
+// it is implemented here to not add a library dependency to --savable models.
+
+struct VlSaveChunk final {
+    uint64_t m_offset;  // File offset of data
+    uint32_t m_storedSize;  // Bytes in file
+    uint32_t m_rawSize;  // Bytes after decompression
+    uint32_t m_compressed;  // 1 if compressed, 0 if stored as is
+    uint32_t m_checksum;  // Low bits of dataHash() of decompressed data
+};
+
+namespace {
+
+// Hash for finding changed blocks and corrupt chunks, not cryptographic
+uint64_t dataHash(const uint8_t* datap, size_t size) {
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, datap + pos, sizeof(word));
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+    for (; pos < size; ++pos) hash = (hash ^ datap[pos]) * 0x100000001b3ULL;
+    return hash;
+}
+
+constexpr size_t VL_SAVE_LZ_MIN_MATCH = 4;
+constexpr size_t VL_SAVE_LZ_HASH_BITS = 14;
+// Final bytes always sent as literals, so matching may read a word past a position
+constexpr size_t VL_SAVE_LZ_LAST_LITERALS = 8;
+
+void lzPutLength(std::vector<uint8_t>& out, size_t length) {
+    for (; length >= 255; length -= 255) out.push_back(255);
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void lzPutSequence(std::vector<uint8_t>& out, const uint8_t* literalp, size_t literals,
+                   size_t offset, size_t matchLength) {
+    const size_t matchCode = matchLength ? matchLength - VL_SAVE_LZ_MIN_MATCH : 0;
+    out.push_back(static_cast<uint8_t>((std::min<size_t>(literals, 15) << 4)
+                                       | std::min<size_t>(matchCode, 15)));
+    if (literals >= 15) lzPutLength(out, literals - 15);
+    out.insert(out.end(), literalp, literalp + literals);
+    if (!matchLength) return;  // Final sequence
+    out.push_back(static_cast<uint8_t>(offset));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15) lzPutLength(out, matchCode - 15);
+}
+
+uint32_t lzRead32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Compress src into out; table is scratch space
+void lzCompress(const uint8_t* srcp, size_t size, std::vector<uint8_t>& out,
+                std::vector<uint32_t>& table) {
+    out.clear();
+    table.assign(1 << VL_SAVE_LZ_HASH_BITS, 0);  // Position + 1, 0 for none
+    size_t anchor = 0;  // Start of pending literals
+    size_t pos = 0;
+    while (size >= VL_SAVE_LZ_LAST_LITERALS && pos + VL_SAVE_LZ_LAST_LITERALS < size) {
+        const uint32_t seq = lzRead32(srcp + pos);
+        const uint32_t hash = (seq * 2654435761U) >> (32 - VL_SAVE_LZ_HASH_BITS);
+        const size_t ref = table[hash];
+        table[hash] = static_cast<uint32_t>(pos + 1);
+        if (!ref || pos - (ref - 1) > 0xffff || lzRead32(srcp + ref - 1) != seq) {
+            // Skip faster through data that does not compress
+            pos += 1 + ((pos - anchor) >> 6);
+            continue;
+        }
+        const size_t match = ref - 1;
+        const size_t limit = size - VL_SAVE_LZ_LAST_LITERALS;
+        size_t length = VL_SAVE_LZ_MIN_MATCH;
+        while (pos + length < limit && srcp[match + length] == srcp[pos + length]) ++length;
+        lzPutSequence(out, srcp + anchor, pos - anchor, pos - match, length);
+        pos += length;
+        anchor = pos;
+    }
+    lzPutSequence(out, srcp + anchor, size - anchor, 0, 0);
+}
+
+// Decompress src into exactly dstSize bytes at dst; false if corrupt
+bool lzDecompress(const uint8_t* srcp, size_t srcSize, uint8_t* dstp, size_t dstSize) {
+    const uint8_t* const srcEndp = srcp + srcSize;
+    size_t out = 0;
+    const auto getLength = [&](size_t length) -> size_t {
+        if (length != 15) return length;
+        while (srcp < srcEndp) {
+            const uint8_t more = *srcp++;
+            length += more;
+            if (more != 255) return length;
+        }
+        return SIZE_MAX;  // Truncated
+    };
+    while (srcp < srcEndp) {
+        const uint8_t token = *srcp++;
+        const size_t literals = getLength(token >> 4);
+        if (literals > static_cast<size_t>(srcEndp - srcp) || literals > dstSize - out) {
+            return false;
+        }
+        std::memcpy(dstp + out, srcp, literals);
+        srcp += literals;
+        out += literals;
+        if (srcp == srcEndp) break;  // Final sequence
+        if (srcEndp - srcp < 2) return false;
+        const size_t offset = srcp[0] | (static_cast<size_t>(srcp[1]) << 8);
+        srcp += 2;
+        const size_t matchCode = getLength(token & 15);
+        if (matchCode == SIZE_MAX || !offset || offset > out) return false;
+        const size_t length = matchCode + VL_SAVE_LZ_MIN_MATCH;
+        if (length > dstSize - out) return false;
+        if (offset == 1) {
+            std::memset(dstp + out, dstp[out - 1], length);
+        } else if (offset >= length) {
+            std::memcpy(dstp + out, dstp + out - offset, length);
+        } else {
+            for (size_t i = 0; i < length; ++i) dstp[out + i] = dstp[out + i - offset];
+        }
+        out += length;
+    }
+    return out == dstSize;
+}
+
+}  // namespace
 
 //=============================================================================
 //=============================================================================
@@ -119,34 +279,538 @@ void VerilatedDeserialize::trailer() VL_MT_UNSAFE_ONE {
     }
 }
 
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// VerilatedSaveWriter
+// Writes the blocks of a VerilatedSave file, on a background thread if
+// asynchronous, either compressing them, or skipping blocks unchanged since
+// the previous incremental save to the same file.
+
+class VerilatedSaveWriter final {
+    // TYPES
+    struct Job final {
+        std::unique_ptr<uint8_t[]> m_bufp;  // Data, whole blocks unless m_last
+        size_t m_size = 0;  // Bytes in m_bufp
+        uint64_t m_offset = 0;  // File offset of m_bufp, a multiple of blockSize()
+        bool m_last = false;  // Data ends at the end of the file
+        bool m_end = false;  // Close the file, of size m_offset
+    };
+    struct FileState final {
+        std::vector<uint64_t> m_hashes;  // Hash of each block
+        uint64_t m_size = 0;  // File size when written
+        time_t m_mtime = 0;  // File modification time when written
+    };
+
+    // MEMBERS
+    // Members below are used by whichever thread executes jobs
+    std::map<std::string, FileState> m_files;  // Last incremental save of each file
+    int m_fd = -1;  // File descriptor we're writing to
+    std::string m_filename;  // Filename, for m_files
+    bool m_incremental = false;  // Compare block hashes
+    bool m_compress = false;  // Write compressed chunks
+    uint64_t m_fileSize = 0;  // Bytes written, when compressing
+    std::vector<VlSaveChunk> m_chunks;  // Chunk index, when compressing
+    std::vector<uint8_t> m_compressed;  // Compression output
+    std::vector<uint32_t> m_compressTable;  // Compression scratch space
+    bool m_reused = false;  // File holds the previous save with m_prevHashes
+    bool m_dirty = false;  // Changed a block of the previous save
+    std::vector<uint64_t> m_prevHashes;  // Block hashes of the previous save
+    std::vector<uint64_t> m_hashes;  // Block hashes of this save
+    uint64_t m_prevSize = 0;  // File size of the previous save
+    uint64_t m_skippedBlocks = 0;  // Unchanged blocks not rewritten, for statistics
+
+    // Background thread, if asynchronous
+    bool m_async = false;  // Jobs are queued to m_thread
+    VerilatedMutex m_mutex;  // Protects below
+    std::condition_variable_any m_cv;  // Signals job queued or completed
+    std::deque<Job> m_jobs VL_GUARDED_BY(m_mutex);  // Jobs for m_thread
+    bool m_busy VL_GUARDED_BY(m_mutex) = false;  // m_thread is executing a job
+    bool m_shutdown VL_GUARDED_BY(m_mutex) = false;  // m_thread should exit
+    // Written buffers for reuse, avoiding page faults on new allocations
+    std::vector<std::unique_ptr<uint8_t[]>> m_freeBufs VL_GUARDED_BY(m_mutex);
+    std::thread m_thread;  // Background thread, started on first asynchronous save
+
+public:
+    // CONSTRUCTORS
+    VerilatedSaveWriter() = default;
+    ~VerilatedSaveWriter() VL_MT_UNSAFE_ONE {
+        if (!m_thread.joinable()) return;
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_shutdown = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+    VL_UNCOPYABLE(VerilatedSaveWriter);
+
+    // METHODS
+    // Start writing a file; the caller must wait() for previous jobs first
+    void begin(int fd, const std::string& filename, bool incremental, bool compress,
+               bool async) VL_MT_UNSAFE_ONE {
+        m_fd = fd;
+        m_filename = filename;
+        m_incremental = incremental;
+        m_compress = compress;
+        m_chunks.clear();
+        if (m_compress) {
+            writeAll(reinterpret_cast<const uint8_t*>(VLTSAVE_CHUNKED_HEADER_STR),
+                     std::strlen(VLTSAVE_CHUNKED_HEADER_STR));
+            m_fileSize = std::strlen(VLTSAVE_CHUNKED_HEADER_STR);
+        }
+        m_reused = false;
+        m_dirty = false;
+        m_prevHashes.clear();
+        m_hashes.clear();
+        m_async = async;
+        if (m_async && !m_thread.joinable()) m_thread = std::thread{[this]() { threadMain(); }};
+        if (!m_incremental) return;
+        const auto it = m_files.find(filename);
+        if (it == m_files.end()) return;
+        // Only trust the hashes if the file is still as we left it
+        struct stat sstat;
+        if (!::fstat(fd, &sstat) && static_cast<uint64_t>(sstat.st_size) == it->second.m_size
+            && sstat.st_mtime == it->second.m_mtime) {
+            m_reused = true;
+            m_prevSize = it->second.m_size;
+            m_prevHashes = std::move(it->second.m_hashes);
+        }
+        m_files.erase(it);
+    }
+    // Write data at the given offset
+    void write(std::unique_ptr<uint8_t[]> bufp, size_t size, uint64_t offset,
+               bool last) VL_MT_UNSAFE_ONE {
+        Job job;
+        job.m_bufp = std::move(bufp);
+        job.m_size = size;
+        job.m_offset = offset;
+        job.m_last = last;
+        run(std::move(job));
+    }
+    // Finish and close the file, of the given size
+    void end(uint64_t size) VL_MT_UNSAFE_ONE {
+        Job job;
+        job.m_offset = size;
+        job.m_end = true;
+        run(std::move(job));
+    }
+    // Return a buffer of the given size, which must not vary
+    uint8_t* newBuffer(size_t size) VL_MT_UNSAFE_ONE {
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            if (!m_freeBufs.empty()) {
+                uint8_t* const bufp = m_freeBufs.back().release();
+                m_freeBufs.pop_back();
+                return bufp;
+            }
+        }
+        return new uint8_t[size];
+    }
+    // Wait for queued jobs to complete
+    void wait() VL_MT_UNSAFE_ONE {
+        const VerilatedLockGuard lock{m_mutex};
+        while (!m_jobs.empty() || m_busy) m_cv.wait(m_mutex);
+    }
+    // Unchanged blocks not rewritten, only valid after wait()
+    uint64_t skippedBlocks() const VL_MT_UNSAFE_ONE { return m_skippedBlocks; }
+
+private:
+    void recycle(std::unique_ptr<uint8_t[]>&& bufp) VL_REQUIRES(m_mutex) {
+        // Keep enough to not allocate while writing keeps up, but not a whole save
+        if (bufp && m_freeBufs.size() < 64) m_freeBufs.emplace_back(std::move(bufp));
+    }
+    void run(Job&& job) VL_MT_UNSAFE_ONE {
+        if (!m_async) {
+            execute(job);
+            const VerilatedLockGuard lock{m_mutex};
+            recycle(std::move(job.m_bufp));
+            return;
+        }
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_jobs.emplace_back(std::move(job));
+        }
+        m_cv.notify_all();
+    }
+    void threadMain() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        while (true) {
+            Job job;
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                while (m_jobs.empty() && !m_shutdown) m_cv.wait(m_mutex);
+                if (m_jobs.empty()) return;
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+                m_busy = true;
+            }
+            execute(job);
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                m_busy = false;
+                recycle(std::move(job.m_bufp));
+            }
+            m_cv.notify_all();
+        }
+    }
+    void execute(const Job& job) {
+        if (job.m_end) {
+            endFile(job.m_offset);
+        } else if (m_compress) {
+            writeCompressed(job.m_bufp.get(), job.m_size);
+        } else if (!m_incremental) {
+            writeAll(job.m_bufp.get(), job.m_size);
+        } else {
+            writeChanged(job.m_bufp.get(), job.m_size, job.m_offset, job.m_last);
+        }
+    }
+    void writeChanged(const uint8_t* datap, size_t size, uint64_t offset, bool last) {
+        const size_t blockSize = VerilatedSave::blockSize();
+        uint64_t block = offset / blockSize;
+        const uint8_t* runp = datap;  // Start of changed blocks not yet written
+        size_t runSize = 0;
+        for (size_t pos = 0; pos < size; pos += blockSize, ++block) {
+            const size_t len = std::min(blockSize, size - pos);
+            const uint64_t hash = dataHash(datap + pos, len);
+            m_hashes.push_back(hash);
+            // The block with the trailer is always written, to validate the file
+            const bool lastBlock = last && pos + len == size;
+            if (m_reused && !lastBlock && block < m_prevHashes.size()
+                && m_prevHashes[block] == hash) {
+                ++m_skippedBlocks;
+                if (runSize) writeAt(runp, runSize, offset + (runp - datap));
+                runSize = 0;
+                continue;
+            }
+            if (m_reused && !m_dirty && !lastBlock) {
+                // Until the trailer is rewritten, make restoring a partial update fail
+                static const uint8_t zeros[8] = {};
+                writeAt(zeros, sizeof(zeros), m_prevSize - sizeof(zeros));
+                m_dirty = true;
+            }
+            if (!runSize) runp = datap + pos;
+            runSize += len;
+        }
+        if (runSize) writeAt(runp, runSize, offset + (runp - datap));
+    }
+    void writeCompressed(const uint8_t* datap, size_t size) {
+        if (!size) return;
+        lzCompress(datap, size, m_compressed, m_compressTable);
+        VlSaveChunk chunk{};
+        chunk.m_offset = m_fileSize;
+        chunk.m_rawSize = static_cast<uint32_t>(size);
+        chunk.m_compressed = m_compressed.size() < size;
+        chunk.m_checksum = static_cast<uint32_t>(dataHash(datap, size));
+        if (chunk.m_compressed) {
+            chunk.m_storedSize = static_cast<uint32_t>(m_compressed.size());
+            writeAll(m_compressed.data(), m_compressed.size());
+        } else {
+            chunk.m_storedSize = static_cast<uint32_t>(size);
+            writeAll(datap, size);
+        }
+        m_fileSize += chunk.m_storedSize;
+        m_chunks.push_back(chunk);
+    }
+    void writeAt(const uint8_t* datap, size_t size, uint64_t offset) {
+        if (VL_UNLIKELY(VL_SAVE_LSEEK(m_fd, offset, SEEK_SET) < 0)) {
+            fatalErrno();  // LCOV_EXCL_LINE
+            return;  // LCOV_EXCL_LINE
+        }
+        writeAll(datap, size);
+    }
+    void writeAll(const uint8_t* datap, size_t size) {
+        const uint8_t* wp = datap;
+        while (true) {
+            const ssize_t remaining = (datap + size - wp);
+            if (remaining == 0) break;
+            errno = 0;
+            const ssize_t got = ::write(m_fd, wp, remaining);
+            if (got > 0) {
+                wp += got;
+            } else if (VL_UNCOVERABLE(got < 0)) {
+                if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                    // write failed, presume error (perhaps out of disk space)
+                    fatalErrno();  // LCOV_EXCL_LINE
+                    break;  // LCOV_EXCL_LINE
+                }
+            }
+        }
+    }
+    void endFile(uint64_t size) {
+        if (m_compress) {
+            const uint64_t footer[2] = {m_chunks.size(), m_fileSize};
+            writeAll(reinterpret_cast<const uint8_t*>(m_chunks.data()),
+                     m_chunks.size() * sizeof(VlSaveChunk));
+            writeAll(reinterpret_cast<const uint8_t*>(footer), sizeof(footer));
+            writeAll(reinterpret_cast<const uint8_t*>(VLTSAVE_CHUNKED_TRAILER_STR),
+                     std::strlen(VLTSAVE_CHUNKED_TRAILER_STR));
+        }
+        if (m_incremental) {
+            // Drop any tail of a previous larger save
+            if (VL_UNLIKELY(VL_SAVE_TRUNCATE(m_fd, size) < 0)) fatalErrno();  // LCOV_EXCL_LINE
+            FileState& state = m_files[m_filename];
+            state.m_hashes = std::move(m_hashes);
+            state.m_size = size;
+            struct stat sstat;
+            if (!::fstat(m_fd, &sstat)) state.m_mtime = sstat.st_mtime;
+        }
+        ::close(m_fd);  // May get error, just ignore it
+        m_fd = -1;
+    }
+    static void fatalErrno() {
+        // LCOV_EXCL_START
+        const std::string msg = "VerilatedSave: "s + std::strerror(errno);
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        // LCOV_EXCL_STOP
+    }
+};
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// VerilatedRestoreChunks
+// Reads the stream of a compressed save file, see VlSaveChunk, with chunks
+// decompressed ahead of the reader by worker threads.
+
+class VerilatedRestoreChunks final {
+    // MEMBERS
+    const int m_fd;  // File descriptor we're reading from
+    std::vector<VlSaveChunk> m_chunks;  // Chunk index
+    VerilatedMutex m_ioMutex;  // Serializes file reads
+    // Decompression window
+    VerilatedMutex m_mutex;  // Protects below
+    std::condition_variable_any m_cv;  // Signals a chunk decompressed or consumed
+    size_t m_window = 0;  // Chunks decompressed ahead of reading
+    std::vector<std::vector<uint8_t>> m_slots VL_GUARDED_BY(m_mutex);  // Chunk % m_window
+    std::vector<int> m_slotStates VL_GUARDED_BY(m_mutex);  // SLOT_* for each slot
+    size_t m_nextDecode VL_GUARDED_BY(m_mutex) = 0;  // Next chunk to decompress
+    size_t m_nextRead VL_GUARDED_BY(m_mutex) = 0;  // Next chunk for the reader
+    bool m_shutdown VL_GUARDED_BY(m_mutex) = false;  // Workers should exit
+    std::vector<std::thread> m_threads;  // Workers
+    // Reader state
+    std::vector<uint8_t> m_current;  // Chunk being read
+    size_t m_currentPos = 0;  // Bytes of m_current already read
+
+    static constexpr int SLOT_EMPTY = 0;
+    static constexpr int SLOT_READY = 1;
+    static constexpr int SLOT_CORRUPT = 2;
+    // Largest chunk to allocate for, VerilatedSave writes up to its buffer size
+    static constexpr uint32_t MAX_CHUNK = 64 * 1024 * 1024;
+
+public:
+    // CONSTRUCTORS
+    explicit VerilatedRestoreChunks(int fd)
+        : m_fd{fd} {}
+    ~VerilatedRestoreChunks() {
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_shutdown = true;
+        }
+        m_cv.notify_all();
+        for (std::thread& thread : m_threads) thread.join();
+    }
+    VL_UNCOPYABLE(VerilatedRestoreChunks);
+
+    // METHODS
+    // Read the index, and start decompressing; false if corrupt
+    bool open(uint64_t fileSize) VL_MT_UNSAFE_ONE {
+        const size_t headerSize = std::strlen(VLTSAVE_CHUNKED_HEADER_STR);
+        const size_t trailerSize = std::strlen(VLTSAVE_CHUNKED_TRAILER_STR);
+        uint64_t footer[2];
+        char trailer[8];
+        if (fileSize < headerSize + sizeof(footer) + trailerSize) return false;
+        if (!readAt(fileSize - trailerSize, trailer, trailerSize)
+            || std::memcmp(trailer, VLTSAVE_CHUNKED_TRAILER_STR, trailerSize)) {
+            return false;
+        }
+        const uint64_t footerOffset = fileSize - trailerSize - sizeof(footer);
+        if (!readAt(footerOffset, footer, sizeof(footer))) return false;
+        const uint64_t nChunks = footer[0];
+        const uint64_t indexOffset = footer[1];
+        if (indexOffset < headerSize || indexOffset > footerOffset
+            || nChunks != (footerOffset - indexOffset) / sizeof(VlSaveChunk)) {
+            return false;
+        }
+        m_chunks.resize(nChunks);
+        if (!readAt(indexOffset, m_chunks.data(), nChunks * sizeof(VlSaveChunk))) return false;
+        for (const VlSaveChunk& chunk : m_chunks) {
+            if (chunk.m_offset < headerSize || chunk.m_offset > indexOffset
+                || chunk.m_storedSize > indexOffset - chunk.m_offset
+                || chunk.m_rawSize > MAX_CHUNK
+                || (!chunk.m_compressed && chunk.m_storedSize != chunk.m_rawSize)) {
+                return false;
+            }
+        }
+        // Start workers, the reader decompresses itself if there is one processor
+        const size_t nThreads = std::min<size_t>(
+            std::min(VlOs::getProcessDefaultParallelism(), 8U), m_chunks.size());
+        m_window = 2 * std::max<size_t>(nThreads, 1);
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_slots.resize(m_window);
+            m_slotStates.assign(m_window, SLOT_EMPTY);
+        }
+        for (size_t i = 0; nThreads > 1 && i < nThreads; ++i) {
+            m_threads.emplace_back([this]() { workerMain(); });
+        }
+        return true;
+    }
+    // Copy up to size bytes of the stream to datap; returns bytes copied, 0 at end.
+    // Returns SIZE_MAX if the file is corrupt
+    size_t read(uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+        size_t got = 0;
+        while (got < size) {
+            if (m_currentPos == m_current.size()) {
+                const int state = nextChunk();
+                if (state == SLOT_CORRUPT) return SIZE_MAX;
+                if (state != SLOT_READY) break;  // End of stream
+            }
+            const size_t blk = std::min(size - got, m_current.size() - m_currentPos);
+            std::memcpy(datap + got, m_current.data() + m_currentPos, blk);
+            got += blk;
+            m_currentPos += blk;
+        }
+        return got;
+    }
+
+private:
+    // Make the next chunk current; returns its SLOT_* state, or SLOT_EMPTY at end
+    int nextChunk() VL_MT_UNSAFE_ONE {
+        m_current.clear();
+        m_currentPos = 0;
+        size_t index;
+        int state;
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            index = m_nextRead;
+            if (index >= m_chunks.size()) return SLOT_EMPTY;
+            const size_t slot = index % m_window;
+            if (m_threads.empty()) {
+                m_slotStates[slot] = decode(index, m_slots[slot]);
+            } else {
+                while (m_slotStates[slot] == SLOT_EMPTY) m_cv.wait(m_mutex);
+            }
+            state = m_slotStates[slot];
+            m_current.swap(m_slots[slot]);
+            m_slotStates[slot] = SLOT_EMPTY;
+            m_nextRead = index + 1;
+        }
+        m_cv.notify_all();
+        return state;
+    }
+    void workerMain() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        std::vector<uint8_t> data;
+        while (true) {
+            size_t index;
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                while (!m_shutdown && m_nextDecode < m_chunks.size()
+                       && m_nextDecode >= m_nextRead + m_window) {
+                    m_cv.wait(m_mutex);
+                }
+                if (m_shutdown || m_nextDecode >= m_chunks.size()) return;
+                index = m_nextDecode++;
+            }
+            const int state = decode(index, data);
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                m_slots[index % m_window].swap(data);
+                m_slotStates[index % m_window] = state;
+            }
+            m_cv.notify_all();
+        }
+    }
+    // Decompress a chunk into data; returns SLOT_READY or SLOT_CORRUPT
+    int decode(size_t index, std::vector<uint8_t>& data) VL_MT_SAFE {
+        const VlSaveChunk& chunk = m_chunks[index];
+        data.resize(chunk.m_rawSize);
+        if (!chunk.m_compressed) {
+            if (!readAt(chunk.m_offset, data.data(), chunk.m_rawSize)) return SLOT_CORRUPT;
+        } else {
+            std::vector<uint8_t> stored(chunk.m_storedSize);
+            if (!readAt(chunk.m_offset, stored.data(), stored.size())
+                || !lzDecompress(stored.data(), stored.size(), data.data(), data.size())) {
+                return SLOT_CORRUPT;
+            }
+        }
+        if (static_cast<uint32_t>(dataHash(data.data(), data.size())) != chunk.m_checksum) {
+            return SLOT_CORRUPT;
+        }
+        return SLOT_READY;
+    }
+    bool readAt(uint64_t offset, void* datap, size_t size) VL_MT_SAFE_EXCLUDES(m_ioMutex) {
+        const VerilatedLockGuard lock{m_ioMutex};
+        if (VL_SAVE_LSEEK(m_fd, offset, SEEK_SET) < 0) return false;
+        uint8_t* rp = static_cast<uint8_t*>(datap);
+        while (size) {
+            errno = 0;
+            const ssize_t got = ::read(m_fd, rp, size);
+            if (got > 0) {
+                rp += got;
+                size -= got;
+            } else if (got == 0 || (errno != EAGAIN && errno != EINTR)) {
+                return false;  // Truncated or read error
+            }
+        }
+        return true;
+    }
+};
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
 // Opening/Closing
 
+VerilatedSave::VerilatedSave() = default;
+VerilatedSave::~VerilatedSave() { closeImp(); }
+
+void VerilatedSave::wait() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (m_writerp) m_writerp->wait();
+}
+
+uint64_t VerilatedSave::skippedBlocks() VL_MT_UNSAFE_ONE {
+    wait();
+    return m_writerp ? m_writerp->skippedBlocks() : 0;
+}
+
 void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (isOpen()) return;
     VL_DEBUG_IF(VL_DBG_MSGF("- save: opening save file %s\n", filenamep););
+    // The previous save may still be writing this file
+    wait();
 
     if (VL_UNCOVERABLE(filenamep[0] == '|')) {
         assert(0);  // LCOV_EXCL_LINE // Not supported yet.
     } else {
+        // Incremental saves keep the file's contents, and truncate when done
+        const int truncFlag = (m_incremental && !m_compress) ? 0 : O_TRUNC;
         // cppcheck-suppress duplicateExpression
         m_fd = ::open(filenamep,
-                      O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_NONBLOCK | O_CLOEXEC, 0666);
+                      O_CREAT | O_WRONLY | truncFlag | O_LARGEFILE | O_NONBLOCK | O_CLOEXEC,
+                      0666);
         if (VL_UNLIKELY(m_fd < 0)) {
             // User code can check isOpen()
             m_isOpen = false;
             return;
         }
     }
+    m_blocks = m_async || m_incremental || m_compress;
+    if (m_blocks) {
+        if (!m_writerp) m_writerp.reset(new VerilatedSaveWriter);
+        m_writerp->begin(m_fd, filenamep, m_incremental && !m_compress, m_compress, m_async);
+        m_offset = 0;
+    }
     m_isOpen = true;
     m_filename = filenamep;
     m_cp = m_bufp;
     header();
 }
 
+VerilatedRestore::VerilatedRestore() = default;
+VerilatedRestore::~VerilatedRestore() { closeImp(); }
+
 void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (isOpen()) return;
@@ -162,6 +826,18 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
             m_isOpen = false;
             return;
         }
+        // Compressed files have their own header, the stream inside has the usual one
+        const size_t headerSize = std::strlen(VLTSAVE_CHUNKED_HEADER_STR);
+        char header[16];
+        struct stat sstat;
+        if (::read(m_fd, header, headerSize) == static_cast<ssize_t>(headerSize)
+            && !std::memcmp(header, VLTSAVE_CHUNKED_HEADER_STR, headerSize)
+            && !::fstat(m_fd, &sstat)) {
+            m_chunksp.reset(new VerilatedRestoreChunks{m_fd});
+            if (VL_UNLIKELY(!m_chunksp->open(sstat.st_size))) corruptChunks(filenamep);
+        } else {
+            VL_SAVE_LSEEK(m_fd, 0, SEEK_SET);
+        }
     }
     m_isOpen = true;
     m_filename = filenamep;
@@ -173,6 +849,13 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
 void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     if (!isOpen()) return;
     trailer();
+    if (m_blocks) {
+        flushBlocks(true);
+        m_writerp->end(m_offset);  // Closes m_fd, possibly later
+        m_fd = -1;
+        m_isOpen = false;
+        return;
+    }
     flushImp();
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
@@ -183,15 +866,25 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     trailer();
     flushImp();
     m_isOpen = false;
+    m_chunksp.reset();
     ::close(m_fd);  // May get error, just ignore it
 }
 
+void VerilatedRestore::corruptChunks(const std::string& filename) VL_MT_UNSAFE_ONE {
+    const std::string msg = "Can't deserialize; corrupt compressed save file: "s + filename;
+    VL_FATAL_MT(filename.c_str(), 0, "", msg.c_str());
+}
+
 //=============================================================================
 // Buffer management
 
 void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
+    if (m_blocks) {
+        flushBlocks(false);
+        return;
+    }
     const uint8_t* wp = m_bufp;
     while (true) {
         const ssize_t remaining = (m_cp - wp);
@@ -215,6 +908,20 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_cp = m_bufp;  // Reset buffer
 }
 
+void VerilatedSave::flushBlocks(bool last) VL_MT_UNSAFE_ONE {
+    // Hand whole blocks, or everything if last, to the writer, which may keep
+    // the buffer until a background write completes; continue in a new buffer
+    const size_t used = m_cp - m_bufp;
+    const size_t size = last ? used : used / blockSize() * blockSize();
+    if (!size && !last) return;
+    std::unique_ptr<uint8_t[]> bufp{m_bufp};
+    m_bufp = m_writerp->newBuffer(bufferSize());
+    std::memcpy(m_bufp, bufp.get() + size, used - size);
+    m_cp = m_bufp + (used - size);
+    m_writerp->write(std::move(bufp), size, m_offset, last);
+    m_offset += size;
+}
+
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
@@ -223,6 +930,20 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     for (const uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
     m_endp = m_bufp + (m_endp - m_cp);
     m_cp = m_bufp;  // Reset buffer
+    if (m_chunksp) {
+        const size_t got = m_chunksp->read(m_endp, m_bufp + bufferSize() - m_endp);
+        if (VL_UNLIKELY(got == SIZE_MAX)) {
+            corruptChunks(filename());
+            return;
+        }
+        m_endp += got;
+        // At end, fill with NULLs as below
+        if (m_endp < m_bufp + bufferSize()) {
+            std::memset(m_endp, 0, m_bufp + bufferSize() - m_endp);
+            m_endp = m_bufp + bufferSize();
+        }
+        return;
+    }
     // Read into buffer starting at m_endp
     while (true) {
         const ssize_t remaining = (m_bufp + bufferSize() - m_endp);
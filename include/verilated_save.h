@@ -26,6 +26,7 @@
 
 #include "verilated.h"
 
+#include <memory>
 #include <string>
 
 //=============================================================================
@@ -188,21 +189,54 @@ private:
 // VerilatedSave
 /// Stream-like object that serializes Verilated model to a file.
 ///
+/// By default data is written to the file as it is serialized.  For long
+/// running simulations that checkpoint periodically, the same object may be
+/// reopened for each checkpoint, with two optional modes:
+///
+/// async(true): Serialization only copies the model into memory, and the
+/// file is written on a background thread, so the simulation stalls for a
+/// memory copy rather than the file write.  This needs memory for a full
+/// copy of the saved state.  The next open(), wait() or destruction waits
+/// for the write to complete.
+///
+/// incremental(true): When saving to a file this object saved before, only
+/// the blocks that differ from that previous checkpoint are rewritten.  The
+/// file is always a complete save file, restored as usual with
+/// VerilatedRestore.  If the update is interrupted, the file's trailer is
+/// left invalid so VerilatedRestore rejects it; alternate between two
+/// filenames to always keep one complete checkpoint.
+///
+/// compress(true): Write a compressed file, in independent chunks that
+/// VerilatedRestore decompresses in parallel.  Incremental saving is not
+/// done for compressed files.
+///
 /// This class is not thread safe, it must be called by a single thread
 
+class VerilatedSaveWriter;
+
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    bool m_async = false;  // Write on a background thread
+    bool m_incremental = false;  // Rewrite only changed blocks
+    bool m_compress = false;  // Write compressed chunks
+    bool m_blocks = false;  // Writing through m_writerp, as a mode was set at open()
+    uint64_t m_offset = 0;  // File offset of m_bufp, when writing blocks
+    std::unique_ptr<VerilatedSaveWriter> m_writerp;  // Block writer, when async or incremental
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
+    void flushBlocks(bool last) VL_MT_UNSAFE_ONE;
 
 public:
+    // Granularity of incremental checking, each a whole number of blocks
+    static constexpr size_t blockSize() { return 64 * 1024L; }
+
     // CONSTRUCTORS
     /// Construct new object
-    VerilatedSave() = default;
+    VerilatedSave();
     /// Flush, close and destruct
-    ~VerilatedSave() override { closeImp(); }
+    ~VerilatedSave() override;
     // METHODS
     /// Open the file; call isOpen() to see if errors
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
@@ -212,27 +246,47 @@ public:
     void close() override VL_MT_UNSAFE_ONE { closeImp(); }
     /// Flush data to file
     void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    /// Write files on a background thread; takes effect on next open()
+    void async(bool flag) VL_MT_UNSAFE_ONE { m_async = flag; }
+    bool async() const VL_MT_SAFE { return m_async; }
+    /// Rewrite only changed blocks of files previously saved; takes effect on next open()
+    void incremental(bool flag) VL_MT_UNSAFE_ONE { m_incremental = flag; }
+    bool incremental() const VL_MT_SAFE { return m_incremental; }
+    /// Write compressed files; takes effect on next open()
+    void compress(bool flag) VL_MT_UNSAFE_ONE { m_compress = flag; }
+    bool compress() const VL_MT_SAFE { return m_compress; }
+    /// Wait for any background writing to complete
+    void wait() VL_MT_UNSAFE_ONE;
+    /// Number of unchanged blocks incremental saves did not rewrite; waits for writing
+    uint64_t skippedBlocks() VL_MT_UNSAFE_ONE;
 };
 
 //=============================================================================
 // VerilatedRestore
 /// Stream-like object that serializes Verilated model from a file.
 ///
+/// Files written by VerilatedSave with compress(true) are detected, and
+/// decompressed ahead of reading on multiple threads.
+///
 /// This class is not thread safe, it must be called by a single thread
 
+class VerilatedRestoreChunks;
+
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    std::unique_ptr<VerilatedRestoreChunks> m_chunksp;  // Chunk reader, if compressed
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
+    static void corruptChunks(const std::string& filename) VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
     /// Construct new object
-    VerilatedRestore() = default;
+    VerilatedRestore();
     /// Flush, close and destruct
-    ~VerilatedRestore() override { closeImp(); }
+    ~VerilatedRestore() override;
 
     // METHODS
     /// Open the file; call isOpen() to see if errors
@@ -34,6 +34,7 @@
 #include "verilated.h"
 #include "verilated_sym_props.h"
 
+#include <cassert>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,14 @@ struct VerilatedCStrCmp final {
     bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
 };
 
+// Class to hash and compare unordered_map keys of const char*'s by contents
+struct VerilatedCStrHash final {
+    size_t operator()(const char* a) const { return static_cast<size_t>(VL_MURMUR64_HASH(a)); }
+};
+struct VerilatedCStrEq final {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) == 0; }
+};
+
 // Map of sorted scope names to find associated scope class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedScopeNameMap final
@@ -55,12 +64,35 @@ public:
     ~VerilatedScopeNameMap() = default;
 };
 
+// Hashed index of scope names, for constant time lookup of a full scope name
+using VerilatedScopeNameHash
+    = std::unordered_map<const char*, const VerilatedScope*, VerilatedCStrHash, VerilatedCStrEq>;
+
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
+// The sorted map gives ordered iteration; a hashed index over the same
+// entries gives constant time lookup by name.
 class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+    std::unordered_map<const char*, VerilatedVar*, VerilatedCStrHash, VerilatedCStrEq> m_hash;
+
 public:
     VerilatedVarNameMap() = default;
     ~VerilatedVarNameMap() = default;
+    // Insert variable, unless one with the same name exists; return the stored variable
+    VerilatedVar* varInsert(const char* namep, VerilatedVar&& var) {
+        const auto itb = emplace(namep, std::move(var));
+        VerilatedVar* const varp = &itb.first->second;
+        if (itb.second) m_hash.emplace(itb.first->first, varp);
+        return varp;
+    }
+    // Find variable by name, nullptr if not found
+    VerilatedVar* varFind(const char* namep) const {
+        const auto it = m_hash.find(namep);
+        return VL_LIKELY(it != m_hash.end()) ? it->second : nullptr;
+    }
+    // First variable with a name starting with prefixp; in sorted order all such
+    // variables follow contiguously, so a walk may stop at the first that does not match
+    const_iterator prefixBegin(const char* prefixp) const { return lower_bound(prefixp); }
 };
 
 // Map of parent scope to vector of children scopes
@@ -72,4 +104,92 @@ public:
     ~VerilatedHierarchyMap() = default;
 };
 
+//======================================================================
+/// Typed view of the storage of a public signal, for reading and writing
+/// model state directly without the VPI.  Obtained from
+/// VerilatedContext::signalFind().
+///
+/// Each element (the whole signal, or one entry of an unpacked array, in
+/// memory order) is stored as its Verilator C type: CData, SData, IData or
+/// QData for packed signals of up to 8, 16, 32 or 64 bits, EData words
+/// (least significant first) for wider packed signals, double for reals
+/// and std::string for strings.  Packed values must be kept with unused
+/// upper bits clear.
+///
+/// The view points into the model, so must not be used after the model is
+/// destroyed; generation() differing from
+/// VerilatedContext::scopesGeneration() indicates this may have happened.
+/// Writes are seen by the model on its next eval().
+
+class VerilatedSignal final {
+    const VerilatedVar* m_varp = nullptr;  // Variable viewed, nullptr if none
+    uint64_t m_generation = 0;  // VerilatedContext::scopesGeneration() when found
+
+public:
+    VerilatedSignal() = default;
+    VerilatedSignal(const VerilatedVar* varp, uint64_t generation)
+        : m_varp{varp}
+        , m_generation{generation} {}
+    ~VerilatedSignal() = default;
+
+    /// True if the view refers to a signal
+    explicit operator bool() const { return m_varp != nullptr; }
+    /// Symbol table entry of the signal
+    const VerilatedVar* varp() const { return m_varp; }
+    /// VerilatedContext::scopesGeneration() when the view was made
+    uint64_t generation() const { return m_generation; }
+    /// Storage type
+    VerilatedVarType vltype() const { return m_varp->vltype(); }
+    /// Width in bits of each element
+    uint32_t bits() const { return m_varp->entBits(); }
+    /// True if the signal may be written (public_flat_rw)
+    bool writable() const { return m_varp->isPublicRW(); }
+    /// Number of elements; product of unpacked dimensions, 1 if none
+    size_t elements() const {
+        size_t n = 1;
+        for (const VerilatedRange& range : m_varp->unpackedRanges()) n *= range.elements();
+        return n;
+    }
+    /// Bytes of storage of each element
+    size_t entSize() const {
+        switch (vltype()) {
+        case VLVT_REAL: return sizeof(double);
+        case VLVT_STRING: return sizeof(std::string);
+        default: return m_varp->entSize();
+        }
+    }
+    /// Pointer to storage of element index, as type T (see class description)
+    template <typename T>
+    T* data(size_t index = 0) const {
+        VL_DEBUG_IFDEF(assert(index < elements()););
+        return reinterpret_cast<T*>(static_cast<uint8_t*>(m_varp->datap()) + index * entSize());
+    }
+    /// Value of element index of a packed signal; lower 64 bits if wider
+    QData read(size_t index = 0) const {
+        switch (vltype()) {
+        case VLVT_UINT8: return *data<CData>(index);
+        case VLVT_UINT16: return *data<SData>(index);
+        case VLVT_UINT32: return *data<IData>(index);
+        case VLVT_UINT64: return *data<QData>(index);
+        case VLVT_WDATA: {
+            const EData* const wordsp = data<EData>(index);
+            return VL_SET_QII(wordsp[1], wordsp[0]);
+        }
+        default: return 0;
+        }
+    }
+    /// Set element index of a packed signal of up to 64 bits, dropping any
+    /// bits above its width. Use data<EData>() for wider signals.
+    void write(QData value, size_t index = 0) const {
+        value &= VL_MASK_Q(bits());
+        switch (vltype()) {
+        case VLVT_UINT8: *data<CData>(index) = static_cast<CData>(value); break;
+        case VLVT_UINT16: *data<SData>(index) = static_cast<SData>(value); break;
+        case VLVT_UINT32: *data<IData>(index) = static_cast<IData>(value); break;
+        case VLVT_UINT64: *data<QData>(index) = value; break;
+        default: break;
+        }
+    }
+};
+
 #endif  // Guard
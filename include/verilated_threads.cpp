@@ -34,6 +34,9 @@
 #ifdef __FreeBSD__
 #include <pthread_np.h>
 #endif
+#ifdef __linux
+#include <sys/mman.h>
+#endif
 
 //=============================================================================
 // Globals
@@ -41,6 +44,10 @@
 // Internal note: Globals may multi-construct, see verilated.cpp top.
 
 std::atomic<uint64_t> VlMTaskVertex::s_yields;
+std::atomic<uint64_t> VlMTaskVertex::s_waitsSpun;
+std::atomic<uint64_t> VlMTaskVertex::s_waitsSlept;
+std::atomic<uint64_t> VlThreadPool::s_steals;
+thread_local VlWorkStealDeque* VlThreadPool::t_dequep = nullptr;
 
 //=============================================================================
 // VlMTaskVertex
@@ -49,6 +56,31 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
     : m_upstreamDepsDone{0}
     , m_upstreamDepCount{upstreamDepCount} {
     assert(atomic_is_lock_free(&m_upstreamDepsDone));
+    assert(upstreamDepCount < SLEEPING);
+}
+
+void VlMTaskVertex::waitUntilUpstreamDoneSlow(bool evenCycle, uint32_t spinLimit) {
+    // Spin for a while, this has the lowest latency if the dependency completes soon
+    for (uint32_t i = 0; i < spinLimit; ++i) {
+        VL_CPU_RELAX();
+        if (areUpstreamDepsDone(evenCycle)) {
+            countWait(false);
+            return;
+        }
+    }
+    countWait(true);
+    // Sleep, so we do not steal cycles from other threads or processes.
+    // Setting SLEEPING and reading the count is a single atomic operation, so
+    // either we see the final count, or the last signalUpstreamDone sees SLEEPING.
+    const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
+    while (true) {
+        const uint32_t current
+            = m_upstreamDepsDone.fetch_or(SLEEPING, std::memory_order_acq_rel) | SLEEPING;
+        if ((current & ~SLEEPING) == target) break;
+        VlOs::futexWait(m_upstreamDepsDone, current);
+    }
+    // Upstream can only be signaled again once this mtask has run, so safe to clear
+    m_upstreamDepsDone.fetch_and(~SLEEPING, std::memory_order_relaxed);
 }
 
 //=============================================================================
@@ -98,15 +130,38 @@ void VlWorkerThread::shutdown() { addTask(shutdownTask, nullptr); }
 
 void VlWorkerThread::wait() {
     // Enqueue a task that sets this flag. Execution is in-order so this ensures completion.
-    std::atomic<bool> flag{false};
-    addTask([](void* flagp, bool) { static_cast<std::atomic<bool>*>(flagp)->store(true); }, &flag);
+    // WAIT_SLEEPING is set if we may be sleeping, then the task wakes us, and
+    // sets WAIT_WOKEN once it no longer touches the flag on our stack.
+    std::atomic<uint32_t> flag{0};
+    addTask(
+        [](void* flagp, bool) {
+            std::atomic<uint32_t>& flagr = *static_cast<std::atomic<uint32_t>*>(flagp);
+            if (flagr.fetch_or(WAIT_DONE, std::memory_order_acq_rel) & WAIT_SLEEPING) {
+                VlOs::futexWake(flagr);
+                flagr.fetch_or(WAIT_WOKEN, std::memory_order_release);
+            }
+        },
+        &flag);
     // Spin wait
-    for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-        if (flag.load()) return;
+    const uint32_t spinLimit = this->spinLimit();
+    for (uint32_t i = 0; i < spinLimit; ++i) {
+        if (flag.load(std::memory_order_acquire) & WAIT_DONE) {
+            VlMTaskVertex::countWait(false);
+            return;
+        }
         VL_CPU_RELAX();
     }
-    // Yield wait
-    while (!flag.load()) std::this_thread::yield();
+    // Sleep wait
+    VlMTaskVertex::countWait(true);
+    uint32_t current = flag.fetch_or(WAIT_SLEEPING, std::memory_order_acq_rel);
+    if (current & WAIT_DONE) return;  // Done before we could sleep, so the task will not wake us
+    current |= WAIT_SLEEPING;
+    while (!(current & WAIT_DONE)) {
+        VlOs::futexWait(flag, current);
+        current = flag.load(std::memory_order_acquire);
+    }
+    // The wake-up is a single system call, so yield rather than sleep for the rest
+    while (!(flag.load(std::memory_order_acquire) & WAIT_WOKEN)) std::this_thread::yield();
 }
 
 void VlWorkerThread::main() {
@@ -118,6 +173,13 @@ void VlWorkerThread::main() {
     dequeWork</* SpinWait: */ false>(&work);
     // Loop until shutdown task is received
     while (VL_UNLIKELY(work.m_fnp != shutdownTask)) {
+        if (work.m_contextp) {
+            // Shared worker: take the context and spin limit of whoever added this task.
+            // The context may be gone once the task completes, so read it now.
+            Verilated::threadContextp(work.m_contextp);
+            m_sharedSpinLimit.store(work.m_contextp->threadsSpinLimit(),
+                                    std::memory_order_relaxed);
+        }
         work.m_fnp(work.m_selfp, work.m_evenCycle);
         // Wait for next task with spinning.
         dequeWork</* SpinWait: */ true>(&work);
@@ -129,22 +191,222 @@ void* VlWorkerThread::start(void* argp) {
     return nullptr;
 }
 
+//=============================================================================
+// VlSharedWorkers
+
+VlSharedWorkers& VlSharedWorkers::s() {
+    static VlSharedWorkers* const s_sharedp = new VlSharedWorkers;
+    return *s_sharedp;
+}
+
+std::vector<VlWorkerThread*> VlSharedWorkers::lease(VerilatedContext* contextp, unsigned nThreads)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    // Have a worker for each available processor, less the calling thread,
+    // but at least as many as any pool needs
+    const unsigned available = VlOs::getProcessAvailableParallelism();
+    const size_t size = std::max<size_t>(nThreads, available > 1 ? available - 1 : 1);
+    while (m_workers.size() < size) {
+        // Serving many contexts, so each task carries its own context
+        m_workers.push_back(new VlWorkerThread{nullptr});
+        m_leases.push_back(0);
+    }
+    // Start the window where the workers are least used by other pools
+    size_t bestStart = 0;
+    uint64_t bestLoad = std::numeric_limits<uint64_t>::max();
+    for (size_t start = 0; start < m_workers.size(); ++start) {
+        uint64_t load = 0;
+        for (size_t i = 0; i < nThreads; ++i) load += m_leases[(start + i) % m_workers.size()];
+        if (load < bestLoad) {
+            bestLoad = load;
+            bestStart = start;
+        }
+    }
+    std::vector<VlWorkerThread*> workers;
+    for (size_t i = 0; i < nThreads; ++i) {
+        const size_t index = (bestStart + i) % m_workers.size();
+        ++m_leases[index];
+        // Spin as the latest lessee asked, until a task brings its own context
+        m_workers[index]->m_sharedSpinLimit.store(contextp->threadsSpinLimit(),
+                                                  std::memory_order_relaxed);
+        workers.push_back(m_workers[index]);
+    }
+    return workers;
+}
+
+void VlSharedWorkers::release(const std::vector<VlWorkerThread*>& workers)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    for (VlWorkerThread* const workerp : workers) {
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            if (m_workers[i] == workerp) --m_leases[i];
+        }
+    }
+}
+
 //=============================================================================
 // VlThreadPool
 
-VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
+VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads, bool shared)
+    : m_contextp{contextp} {
+    m_deques.emplace_back(new VlWorkStealDeque{this, 0});
+    if (shared) {
+        m_workers = VlSharedWorkers::s().lease(contextp, nThreads);
+        m_submitMutexp = &VlSharedWorkers::s().submitMutex();
+    }
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        if (!shared) m_workers.push_back(new VlWorkerThread{contextp});
         m_unassignedWorkers.push(i);
+        m_deques.emplace_back(new VlWorkStealDeque{this, i + 1});
     }
-    m_numaStatus = numaAssign(contextp);
+    // Shared workers are not assigned to processors, as they serve many contexts
+    m_numaStatus = shared ? "shared thread pool" : numaAssign(contextp);
 }
 
 VlThreadPool::~VlThreadPool() {
+    if (m_submitMutexp) {
+        VlSharedWorkers::s().release(m_workers);
+        return;
+    }
     // Each ~WorkerThread will wait for its thread to exit.
     for (auto& i : m_workers) delete i;
 }
 
+void VlThreadPool::dynamicBegin(VlSelfP selfp, bool evenCycle, const VlMTaskVertex* finalp,
+                                uint32_t nMTasks, int nWorkers) {
+    assert(nWorkers >= 0);
+    assert(nWorkers < static_cast<int>(m_deques.size()));
+    m_dynDeques = nWorkers + 1;
+    m_dynSelfp = selfp;
+    m_dynEvenCycle = evenCycle;
+    m_dynFinalp = finalp;
+    // No other thread is looking at the deques between graphs, see dynamicRun
+    for (size_t i = 0; i < m_dynDeques; ++i) m_deques[i]->reset(nMTasks);
+}
+
+void VlThreadPool::dynamicRun(VlExecFnp idleFnp) {
+    const size_t nWorkers = m_dynDeques - 1;
+    m_dynIdleFnp = idleFnp;
+    m_dynActive.store(static_cast<uint32_t>(nWorkers), std::memory_order_relaxed);
+    // addTask synchronizes via the worker mutex, so the workers see the state set above
+    for (size_t i = 0; i < nWorkers; ++i) {
+        m_workers[i]->addTask(dynamicWorkerTask, m_deques[i + 1].get(), false,
+                              m_submitMutexp ? m_contextp : nullptr);
+    }
+    dynamicLoop(*m_deques[0]);
+    // All mtasks are done, but wait for the workers to leave the loop, so the
+    // deques can be safely reset by the next graph.
+    if (!m_dynActive.load(std::memory_order_acquire)) return;
+    const uint32_t spinLimit = this->spinLimit();
+    for (uint32_t i = 0; i < spinLimit; ++i) {
+        VL_CPU_RELAX();
+        if (!m_dynActive.load(std::memory_order_acquire)) {
+            VlMTaskVertex::countWait(false);
+            return;
+        }
+    }
+    VlMTaskVertex::countWait(true);
+    // As in VlMTaskVertex, either we see the final count, or the last worker sees DYN_SLEEPING
+    while (true) {
+        const uint32_t current
+            = m_dynActive.fetch_or(DYN_SLEEPING, std::memory_order_acq_rel) | DYN_SLEEPING;
+        if (current == DYN_SLEEPING) break;
+        VlOs::futexWait(m_dynActive, current);
+    }
+    m_dynActive.store(0, std::memory_order_relaxed);
+}
+
+void VlThreadPool::dynamicWorkerTask(VlSelfP dequep, bool) {
+    VlWorkStealDeque& own = *static_cast<VlWorkStealDeque*>(dequep);
+    VlThreadPool* const poolp = own.poolp();
+    poolp->dynamicLoop(own);
+    const uint32_t prev = poolp->m_dynActive.fetch_sub(1, std::memory_order_acq_rel);
+    if (VL_UNLIKELY(prev == (DYN_SLEEPING | 1))) VlOs::futexWake(poolp->m_dynActive);
+}
+
+void VlThreadPool::dynamicLoop(VlWorkStealDeque& own) {
+    t_dequep = &own;
+    const size_t nDeques = m_dynDeques;
+    const size_t index = own.index();
+    const uint32_t spinLimit = this->spinLimit();
+    uint32_t spins = 0;
+    bool idle = false;  // Found no work since the last mtask
+    while (!m_dynFinalp->areUpstreamDepsDone(m_dynEvenCycle)) {
+        // Prefer own work, which is likely to reuse the data in our caches
+        VlExecFnp fnp = own.pop();
+        if (!fnp) {
+            // Otherwise try to steal from the other threads, starting with our neighbour
+            for (size_t i = 1; i < nDeques && !fnp; ++i) {
+                fnp = m_deques[(index + i) % nDeques]->steal();
+            }
+            if (fnp) ++s_steals;  // Statistics
+        }
+        if (fnp) {
+            if (idle) {
+                idle = false;
+                if (m_dynIdleFnp) m_dynIdleFnp(m_dynSelfp, false);
+            }
+            fnp(m_dynSelfp, m_dynEvenCycle);
+            spins = 0;
+            continue;
+        }
+        if (!idle) {
+            idle = true;
+            if (m_dynIdleFnp) m_dynIdleFnp(m_dynSelfp, true);
+        }
+        // Spin for a while, then sleep until a push or the end of the graph
+        if (++spins < spinLimit) {
+            VL_CPU_RELAX();
+            continue;
+        }
+        spins = 0;
+        m_dynSleepers.fetch_add(1, std::memory_order_seq_cst);
+        const uint32_t wake = m_dynWake.load(std::memory_order_seq_cst);
+        // Recheck once registered: either we see the new work or the end of
+        // the graph, or its producer sees us in m_dynSleepers, see dynamicNotify
+        bool work = m_dynFinalp->areUpstreamDepsDone(m_dynEvenCycle);
+        for (size_t i = 0; i < nDeques && !work; ++i) work = !m_deques[i]->empty();
+        if (!work) {
+            VlMTaskVertex::countWait(true);
+            VlOs::futexWait(m_dynWake, wake);
+        }
+        m_dynSleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (idle && m_dynIdleFnp) m_dynIdleFnp(m_dynSelfp, false);
+    // Threads still sleeping for work will find the graph is done
+    dynamicNotify();
+    t_dequep = nullptr;
+}
+
+void VlThreadPool::numaPlace(int index, void* beginp, void* endp) {
+#ifdef __linux
+    // Without processor assignment the workers may migrate between nodes
+    if (m_numaStatus.rfind("assigned ", 0) != 0) return;
+    if (index < 0 || index >= static_cast<int>(m_workers.size())) return;
+    // Round inwards to whole pages, partial pages are shared with other data
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(beginp) + VL_PAGE_BYTES - 1)
+                            & ~static_cast<uintptr_t>(VL_PAGE_BYTES - 1);
+    const uintptr_t end
+        = reinterpret_cast<uintptr_t>(endp) & ~static_cast<uintptr_t>(VL_PAGE_BYTES - 1);
+    if (end <= begin) return;
+    struct Placement final {
+        char* m_datap;  // Start of the pages
+        std::vector<char> m_contents;  // Contents to rewrite
+    } placement{reinterpret_cast<char*>(begin), {}};
+    placement.m_contents.assign(placement.m_datap, placement.m_datap + (end - begin));
+    // Release the pages, the next write faults them in on the writer's node
+    if (madvise(placement.m_datap, end - begin, MADV_DONTNEED) != 0) return;
+    m_workers[index]->addTask(
+        [](void* selfp, bool) {
+            Placement* const placementp = static_cast<Placement*>(selfp);
+            std::memcpy(placementp->m_datap, placementp->m_contents.data(),
+                        placementp->m_contents.size());
+        },
+        &placement);
+    m_workers[index]->wait();
+#endif
+}
+
 std::string VlThreadPool::numaAssign(VerilatedContext* contextp) {
 #if defined(__linux) || defined(CPU_ZERO) || defined(VL_CPPCHECK)  // Linux-like pthreads
     if (contextp && !contextp->useNumaAssign()) { return "NUMA assignment not requested"; }
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <set>
 #include <stack>
 #include <thread>
@@ -57,6 +58,12 @@ using VlExecFnp = void (*)(VlSelfP, bool);
 class VlMTaskVertex final {
     // MEMBERS
     static std::atomic<uint64_t> s_yields;  // Statistics
+    static std::atomic<uint64_t> s_waitsSpun;  // Statistics, waits satisfied while spinning
+    static std::atomic<uint64_t> s_waitsSlept;  // Statistics, waits that had to sleep
+
+    // Set in m_upstreamDepsDone while a thread might be sleeping in
+    // waitUntilUpstreamDone, so the completing signalUpstreamDone wakes it.
+    static constexpr uint32_t SLEEPING = 1U << 31;
 
     // On even cycles, _upstreamDepsDone increases as upstream
     // dependencies complete. When it reaches _upstreamDepCount,
@@ -91,40 +98,133 @@ public:
         ++s_yields;  // Statistics
         std::this_thread::yield();
     }
+    static uint64_t waitsSpun() { return s_waitsSpun; }
+    static uint64_t waitsSlept() { return s_waitsSlept; }
+    static void countWait(bool slept) {  // Statistics
+        (slept ? s_waitsSlept : s_waitsSpun).fetch_add(1, std::memory_order_relaxed);
+    }
 
     // Upstream mtasks must call this when they complete.
     // Returns true when the current MTaskVertex becomes ready to execute,
     // false while it's still waiting on more dependencies.
     bool signalUpstreamDone(bool evenCycle) {
+        bool ready;
+        uint32_t prev;
         if (evenCycle) {
-            const uint32_t upstreamDepsDone
-                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
+            prev = m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
+            const uint32_t upstreamDepsDone = 1 + (prev & ~SLEEPING);
             assert(upstreamDepsDone <= m_upstreamDepCount);
-            return (upstreamDepsDone == m_upstreamDepCount);
+            ready = (upstreamDepsDone == m_upstreamDepCount);
+        } else {
+            prev = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
+            assert((prev & ~SLEEPING) > 0);
+            ready = ((prev & ~SLEEPING) == 1);
         }
-        const uint32_t upstreamDepsDone_prev
-            = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
-        assert(upstreamDepsDone_prev > 0);
-        return (upstreamDepsDone_prev == 1);
+        if (VL_UNLIKELY(ready && (prev & SLEEPING))) VlOs::futexWake(m_upstreamDepsDone);
+        return ready;
     }
     bool areUpstreamDepsDone(bool evenCycle) const {
         const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
-        return m_upstreamDepsDone.load(std::memory_order_acquire) == target;
+        return (m_upstreamDepsDone.load(std::memory_order_acquire) & ~SLEEPING) == target;
+    }
+    // Wait for upstream dependencies. Spins for up to 'spinLimit' iterations,
+    // then sleeps until woken by the last signalUpstreamDone.
+    void waitUntilUpstreamDone(bool evenCycle, uint32_t spinLimit) {
+        if (VL_LIKELY(areUpstreamDepsDone(evenCycle))) return;
+        waitUntilUpstreamDoneSlow(evenCycle, spinLimit);
+    }
+
+private:
+    void waitUntilUpstreamDoneSlow(bool evenCycle, uint32_t spinLimit);
+};
+
+// Lock-free work-stealing deque of ready mtasks, used by --threads-dynamic.
+// The owning thread pushes and pops at the bottom, other threads steal from
+// the top (Chase-Lev deque, with the memory orderings of Le et al. 2013).
+// Each mtask is pushed at most once per execution of an mtask graph, so the
+// buffer is sized to the number of mtasks in the graph and never wraps.
+class VlWorkStealDeque final {
+    // MEMBERS
+    VlThreadPool* const m_poolp;  // Owning thread pool
+    const size_t m_index;  // Index of this deque in the owning pool
+    std::atomic<int64_t> m_top{0};  // Next index to steal from
+    std::atomic<int64_t> m_bottom{0};  // Next index to push to
+    std::unique_ptr<std::atomic<VlExecFnp>[]> m_bufp;  // Storage
+    size_t m_capacity = 0;  // Size of m_bufp
+
+    VL_UNCOPYABLE(VlWorkStealDeque);
+
+public:
+    // CONSTRUCTORS
+    VlWorkStealDeque(VlThreadPool* poolp, size_t index)
+        : m_poolp{poolp}
+        , m_index{index} {}
+    ~VlWorkStealDeque() = default;
+
+    // ACCESSORS
+    VlThreadPool* poolp() const { return m_poolp; }
+    size_t index() const { return m_index; }
+
+    // METHODS
+    // Empty the deque, and make room for 'capacity' pushes. Must not be
+    // called while any other thread may access this deque.
+    void reset(size_t capacity) {
+        if (capacity > m_capacity) {
+            m_bufp.reset(new std::atomic<VlExecFnp>[capacity]);
+            m_capacity = capacity;
+        }
+        m_top.store(0, std::memory_order_relaxed);
+        m_bottom.store(0, std::memory_order_relaxed);
+    }
+    // Push to the bottom, owner thread only
+    void push(VlExecFnp fnp) {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed);
+        assert(static_cast<size_t>(b) < m_capacity);
+        m_bufp[b].store(fnp, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
     }
-    void waitUntilUpstreamDone(bool evenCycle) const {
-        unsigned ct = 0;
-        while (VL_UNLIKELY(!areUpstreamDepsDone(evenCycle))) {
-            VL_CPU_RELAX();
-            ++ct;
-            if (VL_UNLIKELY(ct > VL_LOCK_SPINS)) {
-                ct = 0;
-                yieldThread();
+    // Pop from the bottom, owner thread only. Returns nullptr if empty.
+    VlExecFnp pop() {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+        if (t > b) {  // Empty
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        VlExecFnp fnp = m_bufp[b].load(std::memory_order_relaxed);
+        if (t == b) {  // Last element, race against thieves
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                fnp = nullptr;
             }
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return fnp;
+    }
+    // Any thread; may be stale by the time it returns
+    bool empty() const {
+        return m_top.load(std::memory_order_acquire) >= m_bottom.load(std::memory_order_acquire);
+    }
+    // Steal from the top, any thread. Returns nullptr if empty or lost a race.
+    VlExecFnp steal() {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        VlExecFnp const fnp = m_bufp[t].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return nullptr;
         }
+        return fnp;
     }
 };
 
 class VlWorkerThread final {
+    friend class VlSharedWorkers;
     friend class VlThreadPool;
 
     // TYPES
@@ -132,11 +232,13 @@ class VlWorkerThread final {
         VlExecFnp m_fnp = nullptr;  // Function to execute
         VlSelfP m_selfp = nullptr;  // Symbol table to execute
         bool m_evenCycle = false;  // Even/odd for flag alternation
+        VerilatedContext* m_contextp = nullptr;  // Context to execute in, if not the thread's
         ExecRec() = default;
-        ExecRec(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
+        ExecRec(VlExecFnp fnp, VlSelfP selfp, bool evenCycle, VerilatedContext* contextp)
             : m_fnp{fnp}
             , m_selfp{selfp}
-            , m_evenCycle{evenCycle} {}
+            , m_evenCycle{evenCycle}
+            , m_contextp{contextp} {}
     };
 
     // MEMBERS
@@ -144,6 +246,12 @@ class VlWorkerThread final {
     std::condition_variable_any m_cv;
     // Only notify the condition_variable if the worker is waiting
     bool m_waiting VL_GUARDED_BY(m_mutex) = false;
+    // Bits of the flag 'wait' enqueues a task to set
+    static constexpr uint32_t WAIT_DONE = 1U << 0;  // Task ran
+    static constexpr uint32_t WAIT_SLEEPING = 1U << 1;  // Waiter may be sleeping
+    static constexpr uint32_t WAIT_WOKEN = 1U << 2;  // Task done with the flag after waking
+    // Spin limit of a shared worker (no m_contextp), from its latest lessee or task
+    std::atomic<uint32_t> m_sharedSpinLimit{VL_LOCK_SPINS};
 
     // Why a vector? We expect the pending list to be very short, typically
     // 0 or 1 or 2, so popping from the front shouldn't be
@@ -163,6 +271,11 @@ class VlWorkerThread final {
     // METHDOS
     static void* start(void*);  // Static entry point, invokes 'main'
     void main();  // 'main' loop of thread
+    // Number of iterations to spin for new work before sleeping
+    uint32_t spinLimit() const {
+        return m_contextp ? m_contextp->threadsSpinLimit()
+                          : m_sharedSpinLimit.load(std::memory_order_relaxed);
+    }
 
     VL_UNCOPYABLE(VlWorkerThread);
 
@@ -175,10 +288,18 @@ public:
     template <bool N_SpinWait>
     void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         // Spin for a while, waiting for new data
+        bool spun = false;
         if VL_CONSTEXPR_CXX17 (N_SpinWait) {
-            for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
-                VL_CPU_RELAX();
+            if (!m_ready_size.load(std::memory_order_relaxed)) {
+                const uint32_t spinLimit = this->spinLimit();
+                for (uint32_t i = 0; i < spinLimit; ++i) {
+                    VL_CPU_RELAX();
+                    if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) {
+                        spun = true;
+                        break;
+                    }
+                }
+                VlMTaskVertex::countWait(!spun);
             }
         }
         const VerilatedLockGuard lock{m_mutex};
@@ -193,12 +314,12 @@ public:
         m_ready.erase(m_ready.begin());
         m_ready_size.fetch_sub(1, std::memory_order_relaxed);
     }
-    void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
-        VL_MT_SAFE_EXCLUDES(m_mutex) {
+    void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false,
+                 VerilatedContext* contextp = nullptr) VL_MT_SAFE_EXCLUDES(m_mutex) {
         bool notify;
         {
             const VerilatedLockGuard lock{m_mutex};
-            m_ready.emplace_back(fnp, selfp, evenCycle);
+            m_ready.emplace_back(fnp, selfp, evenCycle, contextp);
             m_ready_size.fetch_add(1, std::memory_order_relaxed);
             notify = m_waiting;
         }
@@ -209,9 +330,42 @@ public:
     void wait();  // Blocks calling thread until all tasks complete in this thread
 };
 
+// Process-wide worker threads, shared by the VlThreadPool of every
+// VerilatedContext with useSharedThreadPool(true). Each pool leases a window
+// of distinct workers, starting where the workers are used by the fewest
+// other pools, so the contexts spread over the host.
+class VlSharedWorkers final {
+    // MEMBERS
+    VerilatedMutex m_mutex;  // Guards m_workers and m_leases
+    std::vector<VlWorkerThread*> m_workers VL_GUARDED_BY(m_mutex);
+    std::vector<unsigned> m_leases VL_GUARDED_BY(m_mutex);  // Number of pools using each worker
+    // Held while a pool submits the tasks of a schedule, so the tasks of
+    // different schedules are queued in the same order on all workers.
+    VerilatedMutex m_submitMutex;
+
+    // CONSTRUCTORS
+    VlSharedWorkers() = default;
+    VL_UNCOPYABLE(VlSharedWorkers);
+
+public:
+    // The singleton, never destroyed as contexts may outlive static destructors
+    static VlSharedWorkers& s();
+
+    // METHODS
+    // Lease 'nThreads' distinct workers for 'contextp', creating more workers as needed
+    std::vector<VlWorkerThread*> lease(VerilatedContext* contextp, unsigned nThreads)
+        VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Release workers returned by lease
+    void release(const std::vector<VlWorkerThread*>& workers) VL_MT_SAFE_EXCLUDES(m_mutex);
+    VerilatedMutex& submitMutex() { return m_submitMutex; }
+};
+
 class VlThreadPool final : public VerilatedVirtualBase {
     // MEMBERS
     std::vector<VlWorkerThread*> m_workers;  // our workers
+    VerilatedContext* const m_contextp;  // Context using this pool
+    // If the workers are leased from VlSharedWorkers, its submit mutex
+    VerilatedMutex* m_submitMutexp = nullptr;
 
     mutable VerilatedMutex m_mutex;  // Guards indexes of unassigned workers
     // Indexes of unassigned workers
@@ -220,12 +374,29 @@ class VlThreadPool final : public VerilatedVirtualBase {
     std::atomic<unsigned> m_assignedTasks{0};
     std::string m_numaStatus;  // Status of NUMA assignment
 
+    // State of the mtask graph under dynamic execution (--threads-dynamic).
+    // Index 0 of m_deques is for the calling thread, index i+1 for workerp(i).
+    std::vector<std::unique_ptr<VlWorkStealDeque>> m_deques;
+    size_t m_dynDeques = 0;  // Number of deques in use by the current graph
+    VlSelfP m_dynSelfp = nullptr;  // Symbol table of the current graph
+    bool m_dynEvenCycle = false;  // Even/odd flag of the current graph
+    const VlMTaskVertex* m_dynFinalp = nullptr;  // Completes when the current graph is done
+    VlExecFnp m_dynIdleFnp = nullptr;  // Called as a thread goes idle (true) or resumes (false)
+    // Set in m_dynActive while the calling thread might be sleeping in dynamicRun
+    static constexpr uint32_t DYN_SLEEPING = 1U << 31;
+    std::atomic<uint32_t> m_dynActive{0};  // Number of workers still in dynamicLoop
+    std::atomic<uint32_t> m_dynSleepers{0};  // Number of threads sleeping in dynamicLoop
+    std::atomic<uint32_t> m_dynWake{0};  // Bumped to wake threads sleeping in dynamicLoop
+    static std::atomic<uint64_t> s_steals;  // Statistics
+    static thread_local VlWorkStealDeque* t_dequep;  // Deque owned by the current thread
+
 public:
     // CONSTRUCTORS
     // Construct a thread pool with 'nThreads' dedicated threads. The thread
     // pool will create these threads and make them available to execute tasks
-    // via this->workerp(index)->addTask(...)
-    VlThreadPool(VerilatedContext* contextp, unsigned nThreads);
+    // via this->workerp(index)->addTask(...). If 'shared', the threads are
+    // instead leased from VlSharedWorkers.
+    VlThreadPool(VerilatedContext* contextp, unsigned nThreads, bool shared = false);
     ~VlThreadPool() override;
 
     // METHODS
@@ -249,11 +420,62 @@ public:
         assert(index < static_cast<int>(m_workers.size()));
         return m_workers[index];
     }
+    // Generated code brackets adding the tasks of a schedule with these. When
+    // the workers are shared, this makes each schedule's tasks appear in the
+    // same order relative to other schedules on all workers, so workers
+    // waiting on each other cannot deadlock.
+    void submitBegin() VL_NO_THREAD_SAFETY_ANALYSIS {
+        if (m_submitMutexp) m_submitMutexp->lock();
+    }
+    void submitEnd() VL_NO_THREAD_SAFETY_ANALYSIS {
+        if (m_submitMutexp) m_submitMutexp->unlock();
+    }
+
+    // Dynamic, work-stealing execution of an mtask graph (--threads-dynamic).
+    // Generated code calls dynamicBegin, then dynamicPlace for each mtask
+    // without dependencies, then dynamicRun. Each mtask calls dynamicPush for
+    // every successor it makes ready. Mtasks are placed on the thread of
+    // their static schedule, then idle threads steal from busy ones.
+    void dynamicBegin(VlSelfP selfp, bool evenCycle, const VlMTaskVertex* finalp,
+                      uint32_t nMTasks, int nWorkers);
+    // Place ready 'fnp' on deque 'index' (0: calling thread, i+1: workerp(i))
+    void dynamicPlace(int index, VlExecFnp fnp) { m_deques[index]->push(fnp); }
+    // Execute the graph on the calling thread and the workers, until finalp is
+    // done. 'idleFnp', if given, is called on each thread with the graph's
+    // selfp as it starts (true) and stops (false) waiting for work.
+    void dynamicRun(VlExecFnp idleFnp = nullptr);
+    // Push a newly ready mtask onto the deque of the current thread
+    static void dynamicPush(VlExecFnp fnp) {
+        t_dequep->push(fnp);
+        t_dequep->poolp()->dynamicNotify();
+    }
+    static uint64_t steals() { return s_steals; }
+
+    // Move the memory pages fully within [beginp, endp) to the NUMA node of
+    // workerp(index), by releasing them and having the worker rewrite their
+    // contents (first-touch placement). No-op unless workers were assigned to
+    // processors. Call only while no other thread accesses this memory.
+    void numaPlace(int index, void* beginp, void* endp);
 
 private:
     VL_UNCOPYABLE(VlThreadPool);
 
     std::string numaAssign(VerilatedContext* contextp);
+    // Number of iterations to spin for work before sleeping
+    uint32_t spinLimit() const {
+        return m_contextp ? m_contextp->threadsSpinLimit() : VL_LOCK_SPINS;
+    }
+    // Wake threads sleeping in dynamicLoop, after making work available or finishing
+    void dynamicNotify() {
+        // Pairs with the registration in dynamicLoop, so either they see our
+        // work or we see them
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (VL_LIKELY(!m_dynSleepers.load(std::memory_order_relaxed))) return;
+        m_dynWake.fetch_add(1, std::memory_order_relaxed);
+        VlOs::futexWake(m_dynWake);
+    }
+    static void dynamicWorkerTask(VlSelfP dequep, bool);
+    void dynamicLoop(VlWorkStealDeque& own);
 };
 
 #endif
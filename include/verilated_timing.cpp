@@ -23,6 +23,13 @@
 
 #include "verilated_timing.h"
 
+#include "verilated_threads.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
 //======================================================================
 // VlCoroutineHandle:: Methods
 
@@ -57,23 +64,100 @@ void VlCoroutineHandle::dump() const {
 //======================================================================
 // VlDelayScheduler:: Methods
 
+void VlDelayScheduler::insertFar(uint64_t time, VlCoroutineHandle&& handle, bool isolated) {
+    m_far.push_back(FarDelayed{time, m_farSeq++, std::move(handle), isolated});
+    std::push_heap(m_far.begin(), m_far.end(), std::greater<>{});
+}
+
+void VlDelayScheduler::takeSlot(int level, size_t slot) {
+    m_resumeSwap.swap(m_wheel[level][slot]);
+    m_occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+}
+
+size_t VlDelayScheduler::findOccupied(int level, size_t from) const {
+    for (size_t word = from / 64; word < WHEEL_WORDS; ++word) {
+        uint64_t bits = m_occupied[level][word];
+        if (word == from / 64) bits &= ~0ULL << (from % 64);
+        if (bits) return word * 64 + VL_CTZ_Q(bits);
+    }
+    return WHEEL_SIZE;
+}
+
+void VlDelayScheduler::advance(uint64_t time) {
+    const uint64_t diff = time ^ m_now;
+    m_now = time;
+    // All entries are at or after 'time', so every level below the highest one whose slot
+    // changed is empty, and only the slot now containing 'time' on that level needs cascading.
+    if (diff >= (1ULL << (WHEEL_BITS * WHEEL_LEVELS))) {
+        while (!m_far.empty()
+               && (m_far.front().m_time ^ time) < (1ULL << (WHEEL_BITS * WHEEL_LEVELS))) {
+            std::pop_heap(m_far.begin(), m_far.end(), std::greater<>{});
+            FarDelayed& far = m_far.back();
+            insert(far.m_time, std::move(far.m_handle), far.m_isolated);
+            m_far.pop_back();
+        }
+        return;
+    }
+    for (int level = WHEEL_LEVELS - 1; level > 0; --level) {
+        if (diff >= (1ULL << (WHEEL_BITS * level))) {
+            const size_t slot = (time >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+            takeSlot(level, slot);
+            for (Delayed& delayed : m_resumeSwap) {
+                insert(delayed.m_time, std::move(delayed.m_handle), delayed.m_isolated);
+            }
+            m_resumeSwap.clear();
+            return;
+        }
+    }
+}
+
+uint64_t VlDelayScheduler::computeEarliest() const {
+    const size_t slot0 = findOccupied(0, m_now & (WHEEL_SIZE - 1));
+    if (slot0 != WHEEL_SIZE) return (m_now & ~static_cast<uint64_t>(WHEEL_SIZE - 1)) | slot0;
+    for (int level = 1; level < WHEEL_LEVELS; ++level) {
+        const size_t from = ((m_now >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1)) + 1;
+        const size_t slot = findOccupied(level, from);
+        if (slot != WHEEL_SIZE) return m_slotMin[level][slot];
+    }
+    if (m_far.empty()) VL_FATAL_MT(__FILE__, __LINE__, "", "Internal: Delay queue count mismatch");
+    return m_far.front().m_time;
+}
+
+void VlDelayScheduler::clear() {
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+        for (size_t slot = 0; slot < WHEEL_SIZE; ++slot) m_wheel[level][slot].clear();
+        for (size_t word = 0; word < WHEEL_WORDS; ++word) m_occupied[level][word] = 0;
+    }
+    m_far.clear();
+    m_resumeSwap.clear();
+    m_size = 0;
+    m_earliestValid = true;
+    m_zeroDelayed.clear();
+    m_zeroDelayesSwap.clear();
+}
+
 void VlDelayScheduler::resume() {
 #ifdef VL_DEBUG
     VL_DEBUG_IF(dump(); VL_DBG_MSGF("         Resuming delayed processes\n"););
 #endif
     if (VL_UNLIKELY(m_context.gotFinish())) {
-        m_queue.clear();
-        m_zeroDelayed.clear();
-        m_zeroDelayesSwap.clear();
+        clear();
         return;
     }
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
-        resumed = true;
+    const uint64_t time = m_context.time();
+    if (m_size != 0 && earliest() == time) {
+        advance(time);
+        const size_t slot = time & (WHEEL_SIZE - 1);
+        // Coroutines resumed here may schedule more work for this same time slot
+        while (!m_wheel[0][slot].empty()) {
+            takeSlot(0, slot);
+            m_size -= m_resumeSwap.size();
+            m_earliestValid = false;
+            resumeSwap();
+            resumed = true;
+        }
     }
 
     if (!resumed) {
@@ -88,6 +172,56 @@ void VlDelayScheduler::resume() {
     }
 }
 
+void VlDelayScheduler::resumeChunk(void* chunkp, bool) {
+    const ParallelChunk* const cp = static_cast<const ParallelChunk*>(chunkp);
+    for (VlCoroutineHandle* handlep = cp->m_beginp; handlep != cp->m_endp; ++handlep) {
+        handlep->resume();
+    }
+}
+
+void VlDelayScheduler::resumeSwap() {
+    VlThreadPool* poolp = nullptr;
+    if (m_resumeSwap.size() >= 2 * PARALLEL_MIN_PER_THREAD && m_context.threads() > 1) {
+        size_t nIsolated = 0;
+        for (const Delayed& delayed : m_resumeSwap) nIsolated += delayed.m_isolated;
+        if (nIsolated >= 2 * PARALLEL_MIN_PER_THREAD) {
+            poolp = static_cast<VlThreadPool*>(m_context.threadPoolp());
+        }
+    }
+    if (!poolp) {
+        for (Delayed& delayed : m_resumeSwap) delayed.m_handle.resume();
+        m_resumeSwap.clear();
+        return;
+    }
+    for (Delayed& delayed : m_resumeSwap) {
+        if (delayed.m_isolated) m_isolatedSwap.emplace_back(std::move(delayed.m_handle));
+    }
+    // Split the isolated coroutines between this thread and as many workers as they keep busy
+    const size_t nThreads = std::min<size_t>(poolp->numThreads() + 1,
+                                             m_isolatedSwap.size() / PARALLEL_MIN_PER_THREAD);
+    m_chunks.resize(nThreads);
+    VlCoroutineHandle* const beginp = m_isolatedSwap.data();
+    const size_t total = m_isolatedSwap.size();
+    for (size_t i = 0; i < nThreads; ++i) {
+        m_chunks[i].m_beginp = beginp + total * i / nThreads;
+        m_chunks[i].m_endp = beginp + total * (i + 1) / nThreads;
+    }
+    m_parallel = true;
+    poolp->submitBegin();
+    for (size_t i = 1; i < nThreads; ++i) {
+        poolp->workerp(static_cast<int>(i - 1))
+            ->addTask(&resumeChunk, &m_chunks[i], false, &m_context);
+    }
+    poolp->submitEnd();
+    resumeChunk(&m_chunks[0], false);
+    for (size_t i = 1; i < nThreads; ++i) poolp->workerp(static_cast<int>(i - 1))->wait();
+    m_parallel = false;
+    m_isolatedSwap.clear();
+    // Then the rest of the slot, in order (the moved-from isolated handles are null)
+    for (Delayed& delayed : m_resumeSwap) delayed.m_handle.resume();
+    m_resumeSwap.clear();
+}
+
 void VlDelayScheduler::resumeZeroDelay() {
     if (VL_UNLIKELY(m_context.gotFinish())) {
         m_zeroDelayed.clear();
@@ -100,7 +234,7 @@ void VlDelayScheduler::resumeZeroDelay() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (m_size != 0) return earliest();
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
     return m_context.time();
@@ -108,7 +242,7 @@ uint64_t VlDelayScheduler::nextTimeSlot() const {
 
 #ifdef VL_DEBUG
 void VlDelayScheduler::dump() const {
-    if (m_queue.empty() && m_zeroDelayed.empty()) {
+    if (m_size == 0 && m_zeroDelayed.empty()) {
         VL_DBG_MSGF("         No delayed processes:\n");
     } else {
         VL_DBG_MSGF("         Delayed processes:\n");
@@ -118,9 +252,17 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
+        for (int level = 0; level < WHEEL_LEVELS; ++level) {
+            for (size_t slot = 0; slot < WHEEL_SIZE; ++slot) {
+                for (const Delayed& delayed : m_wheel[level][slot]) {
+                    VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", delayed.m_time);
+                    delayed.m_handle.dump();
+                }
+            }
+        }
+        for (const FarDelayed& delayed : m_far) {
+            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", delayed.m_time);
+            delayed.m_handle.dump();
         }
     }
 }
@@ -336,6 +478,51 @@ void VlForkSyncState::done(const char* filename, int lineno) {
     m_inDone = false;
 }
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+thread_local VlCoroutineFramePool::ThreadPool VlCoroutineFramePool::t_pool;
+
+// Statistics summed over threads
+static std::atomic<uint64_t> s_frameAllocs{0};
+static std::atomic<uint64_t> s_frameHeapAllocs{0};
+
+VlCoroutineFramePool::ThreadPool::~ThreadPool() {
+    m_alive = false;
+    publish(*this);
+    for (FreeFrame*& headp : m_freeps) {
+        while (FreeFrame* const framep = headp) {
+            headp = framep->m_nextp;
+            ::operator delete(framep);
+        }
+    }
+}
+
+void* VlCoroutineFramePool::heapAllocate(ThreadPool& pool, size_t size) VL_MT_SAFE {
+    static std::once_flag s_registered;
+    std::call_once(s_registered,
+                   []() { Verilated::addStatsCb([](void*) { statsPrint(); }, nullptr); });
+    ++pool.m_heapAllocs;
+    return ::operator new(size);
+}
+
+void VlCoroutineFramePool::publish(ThreadPool& pool) VL_MT_SAFE {
+    s_frameAllocs += pool.m_allocs;
+    s_frameHeapAllocs += pool.m_heapAllocs;
+    pool.m_allocs = 0;
+    pool.m_heapAllocs = 0;
+}
+
+void VlCoroutineFramePool::statsPrint() VL_MT_SAFE {
+    // Other threads' most recent counts may be unpublished, so totals are approximate
+    publish(t_pool);
+    const uint64_t allocs = s_frameAllocs;
+    if (!allocs) return;
+    const uint64_t reused = allocs - std::min<uint64_t>(allocs, s_frameHeapAllocs);
+    VL_PRINTF("- Verilator: coroutine frames %" PRIu64 " allocated, %0.1f%% reused from pool\n",
+              allocs, 100.0 * reused / allocs);
+}
+
 //======================================================================
 // VlCoroutine:: Methods
 
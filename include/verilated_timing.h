@@ -161,23 +161,94 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
+//
+// Delayed coroutines are kept in a hierarchical timing wheel. Each level has WHEEL_SIZE slots;
+// a coroutine is filed at the lowest level whose slot span contains both its resume time and
+// the wheel's current time, so scheduling a near-future delay is a vector append. When the wheel
+// advances into a new slot of a higher level, that slot is cascaded down into the lower levels.
+// Delays that do not fit in the wheel at all go into a heap ordered by (time, sequence number).
+// Within a time slot, coroutines are resumed in the order they were scheduled.
+//
+// Coroutines scheduled with delayIsolated() come from processes Verilator proved to only touch
+// state no other such process touches (see V3Timing). When enough of them wake up in the same
+// time slot and the context has worker threads, they are resumed concurrently on the thread pool
+// before the remaining coroutines of the slot are resumed in order on the calling thread.
 
 class VlDelayScheduler final {
+    // CONSTANTS
+    static constexpr int WHEEL_BITS = 8;  // log2 of slots per level
+    static constexpr size_t WHEEL_SIZE = 1 << WHEEL_BITS;  // Slots per level
+    static constexpr int WHEEL_LEVELS = 4;  // Levels, covering 2^32 time units
+    static constexpr size_t WHEEL_WORDS = WHEEL_SIZE / 64;  // Occupancy bitmap words per level
+    static constexpr size_t PARALLEL_MIN_PER_THREAD = 4;  // Isolated wakeups to use a thread
+
     // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
+    struct Delayed final {
+        uint64_t m_time;  // Simulation time to resume at
+        VlCoroutineHandle m_handle;  // Coroutine to resume
+        bool m_isolated;  // May be resumed concurrently with other isolated coroutines
+    };
+    struct FarDelayed final {
+        uint64_t m_time;  // Simulation time to resume at
+        uint64_t m_seq;  // Scheduling order, for FIFO resumption within a time slot
+        VlCoroutineHandle m_handle;  // Coroutine to resume
+        bool m_isolated;  // May be resumed concurrently with other isolated coroutines
+        bool operator>(const FarDelayed& rhs) const {
+            return m_time != rhs.m_time ? m_time > rhs.m_time : m_seq > rhs.m_seq;
+        }
+    };
+    using VlDelayedSlot = std::vector<Delayed>;
+    struct Awaitable final {
+        VlProcessRef process;  // Data of the suspended process, null if not needed
+        VlDelayScheduler& scheduler;
+        const uint64_t delay;
+        const VlDelayPhase phase;
+        const VlFileLineDebug fileline;
+        const bool isolated;  // Process is isolated, see delayIsolated()
+
+        bool await_ready() const { return false; }  // Always suspend
+        void await_suspend(std::coroutine_handle<> coro) {
+            // Both active delays and fork..join_none #0 are resumed out of the time queue.
+            if (phase != VlDelayPhase::INACTIVE) {
+                scheduler.schedule(delay, VlCoroutineHandle{coro, process, fileline}, isolated);
+            } else {
+                scheduler.scheduleZeroDelay(VlCoroutineHandle{coro, process, fileline});
+            }
+        }
+        void await_resume() const {}
+    };
+    struct ParallelChunk final {
+        VlCoroutineHandle* m_beginp;  // First coroutine for one thread to resume
+        VlCoroutineHandle* m_endp;  // One past the last
+    };
 
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    uint64_t m_now = 0;  // Time the wheel is positioned at; all entries are at or after this
+    size_t m_size = 0;  // Number of coroutines in the wheel and the far heap
+    uint64_t m_farSeq = 0;  // Next sequence number for m_far
+    mutable uint64_t m_earliest = 0;  // Cached nextTimeSlot(), valid if m_earliestValid
+    mutable bool m_earliestValid = true;  // m_earliest is up to date (or m_size is 0)
+    VlDelayedSlot m_wheel[WHEEL_LEVELS][WHEEL_SIZE];  // Coroutines, by level and slot
+    uint64_t m_occupied[WHEEL_LEVELS][WHEEL_WORDS]{};  // Bitmap of non-empty slots per level
+    uint64_t m_slotMin[WHEEL_LEVELS][WHEEL_SIZE]{};  // Earliest time in each non-empty slot
+    std::vector<FarDelayed> m_far;  // Min-heap of coroutines beyond the wheel's span
+    VlDelayedSlot m_resumeSwap;  // Slot being resumed or cascaded. As member to avoid reallocs
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     // Coroutines that waited for #0 and are being resumed now. As member to avoid reallocations
     std::vector<VlCoroutineHandle> m_zeroDelayesSwap;
+    // Isolated coroutines of the slot being resumed concurrently. As member to avoid reallocs
+    std::vector<VlCoroutineHandle> m_isolatedSwap;
+    std::vector<ParallelChunk> m_chunks;  // Per-thread share of m_isolatedSwap
+    // True while isolated coroutines run on worker threads; scheduling then takes m_mutex
+    bool m_parallel = false;
+    VerilatedMutex m_mutex;  // Guards scheduling while m_parallel
 
 public:
     // CONSTRUCTORS
     explicit VlDelayScheduler(VerilatedContext& context)
-        : m_context{context} {}
+        : m_context{context}
+        , m_now{context.time()} {}
     // METHODS
     // Resume coroutines waiting for the current simulation time
     void resume();
@@ -187,40 +258,60 @@ public:
     // coroutines)
     uint64_t nextTimeSlot() const;
     // Are there no delayed coroutines awaiting?
-    bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
+    bool empty() const { return m_size == 0 && m_zeroDelayed.empty(); }
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
-        return !m_context.gotFinish()
-               && (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()));
+        return !m_context.gotFinish() && m_size != 0 && earliest() <= m_context.time();
     }
     // Are there coroutines to resume in the inactive region after a #0 delay?
     bool awaitingZeroDelay() const { return !m_context.gotFinish() && !m_zeroDelayed.empty(); }
 #ifdef VL_DEBUG
     void dump() const;
 #endif
+    // Schedule a coroutine to be resumed at the given simulation time
+    void schedule(uint64_t time, VlCoroutineHandle&& handle, bool isolated = false) {
+        if (VL_UNLIKELY(m_parallel)) {
+            const VerilatedLockGuard lock{m_mutex};
+            scheduleUnlocked(time, std::move(handle), isolated);
+        } else {
+            scheduleUnlocked(time, std::move(handle), isolated);
+        }
+    }
+    // Schedule a coroutine to be resumed after a #0 delay
+    void scheduleZeroDelay(VlCoroutineHandle&& handle) {
+        if (VL_UNLIKELY(m_parallel)) {
+            const VerilatedLockGuard lock{m_mutex};
+            m_zeroDelayed.emplace_back(std::move(handle));
+        } else {
+            m_zeroDelayed.emplace_back(std::move(handle));
+        }
+    }
     // Used by coroutines for co_awaiting a certain simulation time
     auto delay(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
                int lineno = 0) {
-        struct Awaitable final {
-            VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
-            std::vector<VlCoroutineHandle>& queueZeroDelay;
-            const uint64_t delay;
-            const VlDelayPhase phase;
-            const VlFileLineDebug fileline;
-
-            bool await_ready() const { return false; }  // Always suspend
-            void await_suspend(std::coroutine_handle<> coro) {
-                // Both active delays and fork..join_none #0 are resumed out of the time queue.
-                if (phase != VlDelayPhase::INACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
-                } else {
-                    queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
-                }
-            }
-            void await_resume() const {}
-        };
+        return makeAwaitable(delay, process, VlFileLineDebug{filename, lineno}, false);
+    }
+    // As delay(), for processes whose state is disjoint from all other isolated processes
+    auto delayIsolated(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
+                       int lineno = 0) {
+        return makeAwaitable(delay, process, VlFileLineDebug{filename, lineno}, true);
+    }
 
+private:
+    void scheduleUnlocked(uint64_t time, VlCoroutineHandle&& handle, bool isolated) {
+        if (m_size == 0) {
+            // Empty wheel, reposition to the current time so near delays land on level 0
+            m_now = m_context.time();
+            m_earliest = time;
+            m_earliestValid = true;
+        } else if (m_earliestValid && time < m_earliest) {
+            m_earliest = time;
+        }
+        ++m_size;
+        insert(time, std::move(handle), isolated);
+    }
+    Awaitable makeAwaitable(uint64_t delay, VlProcessRef process, VlFileLineDebug fileline,
+                            bool isolated) {
         VlDelayPhase phase;
         if (delay != 0) {
             // UINT64_MAX is a sentinel for synthetic fork..join_none delays.
@@ -229,10 +320,45 @@ public:
         } else {
             phase = VlDelayPhase::INACTIVE;
         }
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process, *this, m_context.time() + delay, phase, fileline, isolated};
+    }
+    // File a coroutine into the wheel level/slot for its time relative to m_now, or m_far
+    void insert(uint64_t time, VlCoroutineHandle&& handle, bool isolated) {
+        const uint64_t diff = time ^ m_now;
+        for (int level = 0; level < WHEEL_LEVELS; ++level) {
+            if (diff < (1ULL << (WHEEL_BITS * (level + 1)))) {
+                const size_t slot = (time >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+                VlDelayedSlot& delayeds = m_wheel[level][slot];
+                if (delayeds.empty() || time < m_slotMin[level][slot]) {
+                    m_slotMin[level][slot] = time;
+                }
+                delayeds.push_back(Delayed{time, std::move(handle), isolated});
+                m_occupied[level][slot / 64] |= 1ULL << (slot % 64);
+                return;
+            }
+        }
+        insertFar(time, std::move(handle), isolated);
+    }
+    void insertFar(uint64_t time, VlCoroutineHandle&& handle, bool isolated);
+    // Move the wheel to 'time', cascading the slot that now contains it
+    void advance(uint64_t time);
+    // Move the given wheel slot into m_resumeSwap and clear it
+    void takeSlot(int level, size_t slot);
+    // Lowest occupied slot index >= 'from' on a level, or WHEEL_SIZE if none
+    size_t findOccupied(int level, size_t from) const;
+    // Earliest scheduled time, recomputed if the cache is stale; m_size must be non-zero
+    uint64_t earliest() const {
+        if (!m_earliestValid) {
+            m_earliest = computeEarliest();
+            m_earliestValid = true;
+        }
+        return m_earliest;
     }
+    uint64_t computeEarliest() const;
+    void clear();
+    // Resume the coroutines in m_resumeSwap, the isolated ones on the thread pool if worthwhile
+    void resumeSwap();
+    static void resumeChunk(void* chunkp, bool);
 };
 
 //=============================================================================
@@ -440,6 +566,86 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool
+// Allocator for coroutine frames. Testbenches that fork many short-lived
+// processes create and destroy frames at a high rate, so freed frames are kept on
+// free lists, one per size class, and reused instead of going back to the heap.
+// Lists are thread-local; a frame freed on a thread other than the one that
+// allocated it joins the freeing thread's list. Each thread keeps at most
+// MAX_FREE_BYTES of free frames, further frames go back to the heap, so a thread
+// that only frees frames allocated elsewhere does not grow without limit.
+// Define VL_COROUTINE_IMMEDIATE_FREE to use the heap directly, e.g. to aid
+// finding leaks or use-after-free with sanitizers.
+
+class VlCoroutineFramePool final {
+    // Size class granularity in bytes
+    static constexpr size_t GRANULE = 64;
+    // Number of size classes; larger frames are allocated directly from the heap
+    static constexpr size_t CLASSES = 32;
+    // Allocations counted per thread before being added to the global statistics
+    static constexpr uint64_t PUBLISH_EVERY = 4096;
+    // Bytes of free frames kept per thread
+    static constexpr size_t MAX_FREE_BYTES = 1 << 20;
+
+    struct FreeFrame final {
+        FreeFrame* m_nextp;  // Next free frame of the same size class
+    };
+    struct ThreadPool final {
+        FreeFrame* m_freeps[CLASSES] = {};  // Free frames per size class
+        size_t m_freeBytes = 0;  // Bytes in all free lists
+        uint64_t m_allocs = 0;  // Frames allocated, not yet published
+        uint64_t m_heapAllocs = 0;  // Of which needed new heap memory, not yet published
+        bool m_alive = true;  // False once destroyed at thread exit
+        ~ThreadPool();
+    };
+    static thread_local ThreadPool t_pool;
+
+    // Slow path: allocate from the heap
+    static void* heapAllocate(ThreadPool& pool, size_t size) VL_MT_SAFE;
+    // Slow path: add thread's counts to the global statistics
+    static void publish(ThreadPool& pool) VL_MT_SAFE;
+
+public:
+    static void* allocate(size_t size) {
+#ifndef VL_COROUTINE_IMMEDIATE_FREE
+        ThreadPool& pool = t_pool;
+        if (VL_UNLIKELY(++pool.m_allocs >= PUBLISH_EVERY)) publish(pool);
+        if (VL_LIKELY(size <= GRANULE * CLASSES)) {
+            const size_t sizeClass = (size - 1) / GRANULE;
+            if (FreeFrame* const framep = pool.m_freeps[sizeClass]) {
+                pool.m_freeps[sizeClass] = framep->m_nextp;
+                pool.m_freeBytes -= (sizeClass + 1) * GRANULE;
+                return framep;
+            }
+            return heapAllocate(pool, (sizeClass + 1) * GRANULE);
+        }
+        return heapAllocate(pool, size);
+#else
+        return ::operator new(size);
+#endif
+    }
+    static void deallocate(void* ptr, size_t size) noexcept {
+#ifndef VL_COROUTINE_IMMEDIATE_FREE
+        ThreadPool& pool = t_pool;
+        if (VL_LIKELY(size <= GRANULE * CLASSES && pool.m_alive)) {
+            const size_t sizeClass = (size - 1) / GRANULE;
+            const size_t classBytes = (sizeClass + 1) * GRANULE;
+            if (VL_LIKELY(pool.m_freeBytes + classBytes <= MAX_FREE_BYTES)) {
+                FreeFrame* const framep = static_cast<FreeFrame*>(ptr);
+                framep->m_nextp = pool.m_freeps[sizeClass];
+                pool.m_freeps[sizeClass] = framep;
+                pool.m_freeBytes += classBytes;
+                return;
+            }
+        }
+#endif
+        ::operator delete(ptr);
+    }
+    // Print statistics, for VerilatedContext::statsPrintSummary
+    static void statsPrint() VL_MT_SAFE;
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -464,6 +670,12 @@ private:
 
         void unhandled_exception() const { std::abort(); }
         void return_void() const {}
+
+        // Coroutine frames are recycled, see VlCoroutineFramePool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* ptr, size_t size) noexcept {
+            VlCoroutineFramePool::deallocate(ptr, size);
+        }
     };
 
     // MEMBERS
@@ -27,6 +27,7 @@
 #include "verilated.h"
 
 #include <bitset>
+#include <cassert>
 #include <condition_variable>
 #include <memory>
 #include <string>
@@ -103,11 +104,165 @@ enum class VerilatedTraceSigType : uint8_t {
 class VerilatedTraceConfig final {
 public:
     const bool m_useParallel;  // Use parallel tracing
+    const bool m_useOffload;  // Format and write the trace on a separate writer thread
 
-    VerilatedTraceConfig(bool useParallel)
-        : m_useParallel{useParallel} {}
+    VerilatedTraceConfig(bool useParallel, bool useOffload = false)
+        : m_useParallel{useParallel}
+        , m_useOffload{useOffload} {}
 };
 
+//=============================================================================
+// VerilatedTraceOffloadRing
+// Single-producer, single-consumer ring of 32-bit words, passing the value
+// changes recorded by the thread calling 'dump' to the trace writer thread.
+// A growable ring has no consumer thread, and holds the history of triggered
+// tracing until the producer itself replays it.
+// Internal use only
+
+class VerilatedTraceOffloadRing final {
+public:
+    // Record commands, stored in the low 4 bits of the first word of a record,
+    // with the trace code (or flags) above
+    enum Cmd : uint32_t {
+        CHG_BIT_0,  // No payload
+        CHG_BIT_1,  // No payload
+        CHG_CDATA,  // Payload: bits, value
+        CHG_SDATA,  // Payload: bits, value
+        CHG_IDATA,  // Payload: bits, value
+        CHG_QDATA,  // Payload: bits, 2 value words
+        CHG_WDATA,  // Payload: bits, VL_WORDS_I(bits) value words
+        CHG_DOUBLE,  // Payload: 2 value words
+        CHG_EVENT,  // No payload
+        DUMP_BEGIN,  // Flags: full dump. Payload: 2 time words
+        DUMP_END,  // No payload
+        SHUTDOWN  // No payload, writer thread exits
+    };
+    static constexpr size_t DEFAULT_SIZE = 1 << 22;  // Default words in the ring (16 MB)
+    static constexpr uint32_t MAX_CODES = 1U << 28;  // Trace codes that fit above the command
+
+    // First word of a record
+    static uint32_t header(Cmd cmd, uint32_t code) {
+        assert(code < MAX_CODES);
+        return code << 4 | cmd;
+    }
+
+private:
+    size_t m_size;  // Number of words in the ring, a power of 2
+    std::unique_ptr<uint32_t[]> m_wordsp;  // The ring
+    const bool m_growable;  // Grow when full, rather than waiting for the consumer
+    size_t m_writeHead = 0;  // Producer: index of the next word to write
+    size_t m_tailCache = 0;  // Producer: last m_tail seen
+    // Index after the last complete record, written by the producer
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_head{0};
+    // Index after the last consumed word, written by the consumer
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_tail{0};
+    std::atomic<bool> m_sleeping{false};  // Consumer is waiting on m_cv
+    VerilatedMutex m_mutex;  // Mutex for m_cv
+    std::condition_variable_any m_cv;  // Wakes the consumer
+
+    void waitSpace(size_t nWords);
+
+public:
+    explicit VerilatedTraceOffloadRing(size_t size = DEFAULT_SIZE, bool growable = false)
+        : m_size{size}
+        , m_wordsp{new uint32_t[size]}
+        , m_growable{growable} {}
+
+    // Producer: make room for a record of 'nWords', then 'put' its words
+    void reserve(size_t nWords) {
+        if (VL_UNLIKELY(m_writeHead + nWords - m_tailCache > m_size)) waitSpace(nWords);
+    }
+    void put(uint32_t word) { m_wordsp[m_writeHead++ & (m_size - 1)] = word; }
+    void putRecord(Cmd cmd, uint32_t code) {
+        reserve(1);
+        put(header(cmd, code));
+    }
+    // Record with the given payload, and room for 'nExtra' more words 'put' by the caller
+    void putRecord(Cmd cmd, uint32_t code, const uint32_t* payloadp, size_t nPayload,
+                   size_t nExtra = 0) {
+        reserve(1 + nPayload + nExtra);
+        put(header(cmd, code));
+        for (size_t i = 0; i < nPayload; ++i) put(payloadp[i]);
+    }
+    // Producer: make the records written so far visible to the consumer
+    void publish() {
+        m_head.store(m_writeHead, std::memory_order_seq_cst);
+        if (VL_UNLIKELY(m_sleeping.load(std::memory_order_seq_cst))) {
+            const VerilatedLockGuard lock{m_mutex};
+            m_cv.notify_one();
+        }
+    }
+    // Producer: wait until the consumer processed all records
+    void drain() {
+        publish();
+        unsigned ct = 0;
+        while (m_tail.load(std::memory_order_acquire) != m_writeHead) {
+            VL_CPU_RELAX();
+            if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+                ct = 0;
+                std::this_thread::yield();
+            }
+        }
+        m_tailCache = m_writeHead;
+    }
+
+    // Consumer: wait until there are records after 'tail', return the new head
+    size_t waitData(size_t tail) {
+        for (int i = 0; i < VL_LOCK_SPINS; ++i) {
+            const size_t head = m_head.load(std::memory_order_acquire);
+            if (head != tail) return head;
+            VL_CPU_RELAX();
+        }
+        // Sleep, 'publish' will wake us if it sees m_sleeping, or we see its m_head
+        size_t head = tail;
+        const VerilatedLockGuard lock{m_mutex};
+        m_sleeping.store(true, std::memory_order_seq_cst);
+        m_cv.wait(m_mutex, [&]() {
+            head = m_head.load(std::memory_order_seq_cst);
+            return head != tail;
+        });
+        m_sleeping.store(false, std::memory_order_relaxed);
+        return head;
+    }
+    uint32_t at(size_t index) const { return m_wordsp[index & (m_size - 1)]; }
+    // Consumer: release the words before 'tail'
+    void consumed(size_t tail) { m_tail.store(tail, std::memory_order_release); }
+
+    // Index of the next word to write, where the next record starts
+    size_t writeHead() const { return m_writeHead; }
+    // Index of the oldest word not yet consumed
+    size_t tail() const { return m_tail.load(std::memory_order_acquire); }
+};
+
+inline void VerilatedTraceOffloadRing::waitSpace(size_t nWords) {
+    if (m_growable) {
+        // No consumer, so double the ring, keeping each word at the same index
+        m_tailCache = m_tail.load(std::memory_order_acquire);
+        size_t newSize = m_size;
+        while (m_writeHead + nWords - m_tailCache > newSize) newSize *= 2;
+        if (newSize == m_size) return;
+        std::unique_ptr<uint32_t[]> newWordsp{new uint32_t[newSize]};
+        for (size_t i = m_tailCache; i != m_writeHead; ++i) {
+            newWordsp[i & (newSize - 1)] = m_wordsp[i & (m_size - 1)];
+        }
+        m_wordsp = std::move(newWordsp);
+        m_size = newSize;
+        return;
+    }
+    // Let the consumer make progress on what we have so far
+    publish();
+    unsigned ct = 0;
+    while (true) {
+        m_tailCache = m_tail.load(std::memory_order_acquire);
+        if (m_writeHead + nWords - m_tailCache <= m_size) return;
+        VL_CPU_RELAX();
+        if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+            ct = 0;
+            std::this_thread::yield();
+        }
+    }
+}
+
 //=============================================================================
 // VerilatedTraceBaseC - base class of all Verilated*C trace classes
 // Internal use only
@@ -183,6 +338,33 @@ private:
     };
 
     bool m_parallel = false;  // Use parallel tracing
+    bool m_offload = false;  // Format and write the trace on m_offloadThread
+
+    // Offloading state, used when m_offload, after traceInit
+    std::unique_ptr<VerilatedTraceOffloadRing> m_offloadRingp;  // Records to the writer thread
+    std::unique_ptr<Buffer> m_offloadBufp;  // Buffer recording into m_offloadRingp
+    std::thread m_offloadThread;  // The writer thread
+
+    // Triggered tracing state, see 'triggerHistory'
+    uint64_t m_historyDumps = 0;  // Number of dumps to hold back, 0 if not armed
+    uint64_t m_historyCount = 0;  // Dumps recorded since the last full dump of the history
+    size_t m_historySegment = 0;  // Ring index of the last full dump of the history
+    std::unique_ptr<VerilatedTraceOffloadRing> m_historyRingp;  // The held back dumps
+    std::unique_ptr<Buffer> m_historyBufp;  // Buffer recording into m_historyRingp
+
+    Buffer* m_recordBufp = nullptr;  // Buffer recording the current dump, if not emitting it
+
+    // Main loop of the writer thread
+    void offloadWorkerThreadMain();
+    // Emit the records in the ring between 'tail' and 'head', return false on SHUTDOWN
+    bool emitRecords(VerilatedTraceOffloadRing& ring, size_t& tail, size_t head, Buffer*& bufp,
+                     std::vector<uint32_t>& wide);
+    // Fatal if trace codes would not fit in the records of a ring
+    void checkRingCodes() const;
+    // Record a whole dump into the ring, through the given recording buffer
+    void recordDump(VerilatedTraceOffloadRing& ring, Buffer* bufp, uint64_t timeui);
+    // Write out the held back history, and stop holding back
+    void triggerImp();
 
     struct ParallelWorkerData final {
         const dumpCb_t m_cb;  // The callback
@@ -215,8 +397,10 @@ private:
     std::vector<CallbackRecord> m_fullCbs;  // Routines to perform full dump
     std::vector<CallbackRecord> m_chgCbs;  // Routines to perform incremental dump
     std::vector<CallbackRecord> m_cleanupCbs;  // Routines to call at the end of dump
-    bool m_constDump = true;  // Whether a const dump is required on the next call to 'dump'
-    bool m_fullDump = true;  // Whether a full dump is required on the next call to 'dump'
+    // Whether a const dump is required on the next call to 'dump'
+    std::atomic<bool> m_constDump{true};  // Atomic, as may be set by the writer thread
+    // Whether a full dump is required on the next call to 'dump'
+    std::atomic<bool> m_fullDump{true};  // Atomic, as may be set by the writer thread
     uint32_t m_nextCode = 0;  // Next code number to assign
     uint32_t m_numSignals = 0;  // Number of distinct signals
     uint32_t m_maxBits = 0;  // Number of bits in the widest signal
@@ -321,6 +505,11 @@ public:
 
     // Call
     void dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Hold back at least the last 'dumps' calls to 'dump' in memory, and write
+    // them only when triggered, zero to stop holding back
+    void triggerHistory(uint64_t dumps) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Write the held back dumps, then continue writing each dump as usual
+    void trigger() VL_MT_SAFE_EXCLUDES(m_mutex);
 
     //=========================================================================
     // Internal interface to Verilator generated code
@@ -357,8 +546,12 @@ protected:
     friend Trace;  // Give the trace file access to the private bits
     friend std::default_delete<VerilatedTraceBuffer<T_Buffer>>;
 
+    friend VerilatedTrace<Trace, T_Buffer>;  // Sets up m_recordRingp
+
     uint32_t* const m_sigs_oldvalp;  // Previous value store
     EData* const m_sigs_enabledp;  // Bit vector of enabled codes (nullptr = all on)
+    // If offloading or holding back history, record value changes here instead of emitting them
+    VerilatedTraceOffloadRing* m_recordRingp = nullptr;
 
     explicit VerilatedTraceBuffer(Trace& owner);
     ~VerilatedTraceBuffer() override = default;
@@ -434,6 +627,15 @@ public:
         std::memcpy(&old, oldp, sizeof(old));
         if (VL_UNLIKELY(old != newval)) fullDouble(oldp, newval);
     }
+
+    // Check previous dumped values of the 'n' elements of an unpacked array
+    // with consecutive codes, comparing several elements at once with SIMD
+    // where available. Emit trace entries for the elements that changed.
+    void chgBitArray(uint32_t* oldp, const CData* newp, int n);
+    void chgCDataArray(uint32_t* oldp, const CData* newp, int n, int bits);
+    void chgSDataArray(uint32_t* oldp, const SData* newp, int n, int bits);
+    void chgIDataArray(uint32_t* oldp, const IData* newp, int n, int bits);
+    void chgQDataArray(uint32_t* oldp, const QData* newp, int n, int bits);
 };
 
 #endif  // guard
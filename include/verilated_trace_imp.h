@@ -53,15 +53,6 @@ static double timescaleToDouble(const char* unitp) VL_PURE {
     return value;
 }
 
-//=============================================================================
-// Life cycle
-
-template <>
-void VerilatedTrace<VL_SUB_T, VL_BUF_T>::closeBase() {}
-
-template <>
-void VerilatedTrace<VL_SUB_T, VL_BUF_T>::flushBase() {}
-
 //=============================================================================
 // Callbacks to run on global events
 
@@ -94,6 +85,162 @@ VerilatedTrace<VL_SUB_T, VL_BUF_T>::~VerilatedTrace() {
     Verilated::removeExitCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onExit, this);
 }
 
+//=========================================================================
+// VerilatedTraceBuffer construction, used by recording below
+
+template <>
+VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
+    : VL_BUF_T{owner}
+    , m_sigs_oldvalp{owner.m_sigs_oldvalp}
+    , m_sigs_enabledp{owner.m_sigs_enabledp} {}
+
+//=========================================================================
+// Trace writer thread (offloading) and triggered history
+
+template <>
+bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::emitRecords(VerilatedTraceOffloadRing& ring,
+                                                     size_t& tail, size_t head, Buffer*& bufp,
+                                                     std::vector<uint32_t>& wide) {
+    using Ring = VerilatedTraceOffloadRing;
+    while (tail != head) {
+        const uint32_t word = ring.at(tail++);
+        const uint32_t code = word >> 4;
+        switch (static_cast<Ring::Cmd>(word & 0xf)) {
+        case Ring::CHG_BIT_0:
+            if (bufp) bufp->emitBit(code, 0);
+            break;
+        case Ring::CHG_BIT_1:
+            if (bufp) bufp->emitBit(code, 1);
+            break;
+        case Ring::CHG_CDATA: {
+            const int bits = ring.at(tail++);
+            const CData value = ring.at(tail++);
+            if (bufp) bufp->emitCData(code, value, bits);
+            break;
+        }
+        case Ring::CHG_SDATA: {
+            const int bits = ring.at(tail++);
+            const SData value = ring.at(tail++);
+            if (bufp) bufp->emitSData(code, value, bits);
+            break;
+        }
+        case Ring::CHG_IDATA: {
+            const int bits = ring.at(tail++);
+            const IData value = ring.at(tail++);
+            if (bufp) bufp->emitIData(code, value, bits);
+            break;
+        }
+        case Ring::CHG_QDATA: {
+            const int bits = ring.at(tail++);
+            const QData lo = ring.at(tail++);
+            const QData hi = ring.at(tail++);
+            if (bufp) bufp->emitQData(code, hi << 32 | lo, bits);
+            break;
+        }
+        case Ring::CHG_WDATA: {
+            const int bits = ring.at(tail++);
+            for (int i = 0; i < VL_WORDS_I(bits); ++i) wide[i] = ring.at(tail++);
+            if (bufp) bufp->emitWData(code, WDataInP::external(wide.data()), bits);
+            break;
+        }
+        case Ring::CHG_DOUBLE: {
+            const uint64_t lo = ring.at(tail++);
+            const uint64_t hi = ring.at(tail++);
+            const uint64_t bits = hi << 32 | lo;
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (bufp) bufp->emitDouble(code, value);
+            break;
+        }
+        case Ring::CHG_EVENT:
+            if (bufp) bufp->emitEvent(code);
+            break;
+        case Ring::DUMP_BEGIN: {
+            const uint64_t lo = ring.at(tail++);
+            const uint64_t hi = ring.at(tail++);
+            // Call hook for format-specific behaviour, as in 'dump'
+            const bool fullDump = code & 1;
+            if (fullDump ? preFullDump() : preChangeDump()) {
+                emitTimeChange(hi << 32 | lo);
+                bufp = getTraceBuffer(0);
+            }
+            break;
+        }
+        case Ring::DUMP_END:
+            if (bufp) commitTraceBuffer(bufp);
+            bufp = nullptr;
+            // Release the space early, the producer might be waiting for it
+            ring.consumed(tail);
+            break;
+        case Ring::SHUTDOWN: return false;
+        default:  // LCOV_EXCL_START
+            VL_FATAL_MT(__FILE__, __LINE__, "", "Internal: Unknown trace offload command");
+            break;
+        }  // LCOV_EXCL_STOP
+    }
+    return true;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
+    VerilatedTraceOffloadRing& ring = *m_offloadRingp;
+    // Staging for wide values, which might wrap around the end of the ring
+    std::vector<uint32_t> wide(VL_WORDS_I(maxBits()) + 1);
+    // Format-specific buffer of the current dump, nullptr if not emitting it
+    Buffer* bufp = nullptr;
+    size_t tail = 0;
+    while (true) {
+        const size_t head = ring.waitData(tail);
+        const bool running = emitRecords(ring, tail, head, bufp, wide);
+        ring.consumed(tail);
+        if (!running) return;
+    }
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::triggerImp() {
+    m_historyDumps = 0;
+    if (!m_historyRingp) return;  // Nothing dumped since armed
+    // If offloading, the writer thread must be idle, as we emit on this thread
+    if (m_offloadThread.joinable()) m_offloadRingp->drain();
+    VerilatedTraceOffloadRing& ring = *m_historyRingp;
+    std::vector<uint32_t> wide(VL_WORDS_I(maxBits()) + 1);
+    Buffer* bufp = nullptr;
+    size_t tail = ring.tail();
+    emitRecords(ring, tail, ring.writeHead(), bufp, wide);
+    m_historyBufp.reset();
+    m_historyRingp.reset();
+}
+
+//=============================================================================
+// Life cycle
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::closeBase() {
+    // Discard any history that was never triggered, reopening starts afresh
+    m_historyBufp.reset();
+    m_historyRingp.reset();
+    if (!m_offloadThread.joinable()) return;
+    // Stop the writer thread, once it has written all pending records
+    m_offloadRingp->putRecord(VerilatedTraceOffloadRing::SHUTDOWN, 0);
+    m_offloadRingp->publish();
+    m_offloadThread.join();
+    m_offloadBufp.reset();
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::flushBase() {
+    // The writer thread itself flushes when rolling over to the next file
+    if (m_offloadThread.joinable() && std::this_thread::get_id() == m_offloadThread.get_id()) {
+        return;
+    }
+    // Flushing due to $stop, $fatal or a failed assertion triggers writing the history
+    if (VL_UNLIKELY(m_historyDumps && m_contextp && m_contextp->gotError())) triggerImp();
+    if (!m_offloadThread.joinable()) return;
+    // Wait for the writer thread to write all pending records
+    m_offloadRingp->drain();
+}
+
 //=========================================================================
 // Internals available to format-specific implementations
 
@@ -116,6 +263,15 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runInitCallback(size_t index,
     m_initCbsCalled[index] = true;
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::checkRingCodes() const {
+    if (VL_LIKELY(nextCode() <= VerilatedTraceOffloadRing::MAX_CODES)) return;
+    const std::string msg = "Too many trace codes (" + std::to_string(nextCode())
+                            + ") for --trace-offload or triggered tracing, maximum "
+                            + std::to_string(VerilatedTraceOffloadRing::MAX_CODES);
+    VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     // Note: It is possible to re-open a trace file (VCD in particular),
@@ -160,6 +316,15 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
         m_sigs_enabledVec.clear();
     }
 
+    // Start the writer thread. Each open uses a new ring, so it starts empty.
+    if (m_offload && !m_offloadThread.joinable()) {
+        checkRingCodes();
+        m_offloadRingp.reset(new VerilatedTraceOffloadRing);
+        m_offloadBufp.reset(new Buffer{*self()});
+        m_offloadBufp->m_recordRingp = m_offloadRingp.get();
+        m_offloadThread = std::thread{[this] { offloadWorkerThreadMain(); }};
+    }
+
     // Set callback so flush/abort will flush this file
     Verilated::addFlushCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onFlush, this);
     Verilated::addExitCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onExit, this);
@@ -270,6 +435,11 @@ VL_ATTR_NOINLINE void VerilatedTrace<VL_SUB_T, VL_BUF_T>::ParallelWorkerData::wa
 
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<CallbackRecord>& cbVec) {
+    if (m_recordBufp) {
+        // If recording, record all changes in order, they are emitted later
+        for (const CallbackRecord& cbr : cbVec) cbr.m_dumpCb(cbr.m_userp, m_recordBufp);
+        return;
+    }
     if (parallel()) {
         // If tracing in parallel, dispatch to the thread pool
         VlThreadPool* threadPoolp = static_cast<VlThreadPool*>(m_contextp->threadPoolp());
@@ -317,6 +487,22 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
     }
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::recordDump(VerilatedTraceOffloadRing& ring, Buffer* bufp,
+                                                    uint64_t timeui) {
+    const bool fullDump = m_fullDump.exchange(false);
+    ring.reserve(3);
+    ring.put(VerilatedTraceOffloadRing::header(VerilatedTraceOffloadRing::DUMP_BEGIN, fullDump));
+    ring.put(static_cast<uint32_t>(timeui));
+    ring.put(static_cast<uint32_t>(timeui >> 32));
+    m_recordBufp = bufp;
+    runCallbacks(fullDump ? m_fullCbs : m_chgCbs);
+    if (VL_UNLIKELY(m_constDump.exchange(false))) runCallbacks(m_constCbs);
+    m_recordBufp = nullptr;
+    ring.putRecord(VerilatedTraceOffloadRing::DUMP_END, 0);
+    ring.publish();
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex) {
     // Not really VL_MT_SAFE but more VL_MT_UNSAFE_ONE.
@@ -334,6 +520,38 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
 
     Verilated::quiesce();
 
+    if (VL_UNLIKELY(m_historyDumps)) {
+        // Holding back history until triggered
+        if (!m_historyRingp) {
+            checkRingCodes();
+            m_historyRingp.reset(new VerilatedTraceOffloadRing{1 << 16, true});
+            m_historyBufp.reset(new Buffer{*self()});
+            m_historyBufp->m_recordRingp = m_historyRingp.get();
+            m_historySegment = 0;
+            m_historyCount = m_historyDumps;
+        }
+        if (m_historyCount >= m_historyDumps) {
+            // Every 'm_historyDumps' dumps start a new segment with a full dump, so the
+            // history can always be written from its start. Keep only the last two segments.
+            m_historyRingp->consumed(m_historySegment);
+            m_historySegment = m_historyRingp->writeHead();
+            m_historyCount = 0;
+            m_fullDump = true;
+            m_constDump = true;
+        }
+        ++m_historyCount;
+        recordDump(*m_historyRingp, m_historyBufp.get(), timeui);
+        for (const CallbackRecord& cbr : m_cleanupCbs) cbr.m_cleanupCb(cbr.m_userp, self());
+        return;
+    }
+
+    if (m_offloadBufp) {
+        // Record the dump for the writer thread, which calls the format-specific hooks
+        recordDump(*m_offloadRingp, m_offloadBufp.get(), timeui);
+        for (const CallbackRecord& cbr : m_cleanupCbs) cbr.m_cleanupCb(cbr.m_userp, self());
+        return;
+    }
+
     // Call hook for format-specific behaviour
     if (VL_UNLIKELY(m_fullDump)) {
         if (!preFullDump()) return;
@@ -360,6 +578,26 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
     for (const CallbackRecord& cbr : m_cleanupCbs) cbr.m_cleanupCb(cbr.m_userp, self());
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::triggerHistory(uint64_t dumps)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    // Discard what was held back so far, so the next dump must be full
+    if (m_historyRingp) {
+        m_historyBufp.reset();
+        m_historyRingp.reset();
+        m_fullDump = true;
+        m_constDump = true;
+    }
+    m_historyDumps = dumps;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::trigger() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    triggerImp();
+}
+
 //=============================================================================
 // Non-hot path internal interface to Verilator generated code
 
@@ -395,6 +633,10 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::addModel(VerilatedModel* modelp)
     // Configure trace base class
     // If at least one model requests parallel tracing, then use it
     m_parallel |= configp->m_useParallel;
+    // If at least one model requests offloading, then use it. Offloading records
+    // all changes in order on the calling thread, so is not also parallel.
+    m_offload |= configp->m_useOffload;
+    if (m_offload) m_parallel = false;
 
     // Configure format-specific sub class
     configure(*(configp.get()));
@@ -534,13 +776,127 @@ inline void cvtQDataToStr(char* dstp, QData value) {
 #define cvtEDataToStr cvtIDataToStr
 
 //=========================================================================
-// VerilatedTraceBuffer
+// Array change detection helpers
+
+// Return bit mask of which of the 8 elements at 'newp' differ from the
+// previous values at 'oldp', which hold one (or for QData two) words each
+static inline uint32_t vlTraceDiffMask8(const uint32_t* oldp, const CData* newp) {
+#if defined(VL_HAVE_AVX2)
+    const __m256i n = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(newp)));
+    const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp));
+    return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(n, o))) & 0xff;
+#elif defined(VL_HAVE_SSE2)
+    const __m128i z = _mm_setzero_si128();
+    const __m128i n = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(newp)), z);
+    const __m128i o0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp));
+    const __m128i o1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + 4));
+    const int m0 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_unpacklo_epi16(n, z), o0)));
+    const int m1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_unpackhi_epi16(n, z), o1)));
+    return ~(m0 | m1 << 4) & 0xff;
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) mask |= static_cast<uint32_t>(oldp[i] != newp[i]) << i;
+    return mask;
+#endif
+}
 
-template <>
-VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
-    : VL_BUF_T{owner}
-    , m_sigs_oldvalp{owner.m_sigs_oldvalp}
-    , m_sigs_enabledp{owner.m_sigs_enabledp} {}
+static inline uint32_t vlTraceDiffMask8(const uint32_t* oldp, const SData* newp) {
+#if defined(VL_HAVE_AVX2)
+    const __m256i n = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(newp)));
+    const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp));
+    return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(n, o))) & 0xff;
+#elif defined(VL_HAVE_SSE2)
+    const __m128i z = _mm_setzero_si128();
+    const __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newp));
+    const __m128i o0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp));
+    const __m128i o1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + 4));
+    const int m0 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_unpacklo_epi16(n, z), o0)));
+    const int m1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_unpackhi_epi16(n, z), o1)));
+    return ~(m0 | m1 << 4) & 0xff;
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) mask |= static_cast<uint32_t>(oldp[i] != newp[i]) << i;
+    return mask;
+#endif
+}
+
+static inline uint32_t vlTraceDiffMask8(const uint32_t* oldp, const IData* newp) {
+#if defined(VL_HAVE_AVX2)
+    const __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(newp));
+    const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp));
+    return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(n, o))) & 0xff;
+#elif defined(VL_HAVE_SSE2)
+    const __m128i n0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newp));
+    const __m128i n1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newp + 4));
+    const __m128i o0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp));
+    const __m128i o1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + 4));
+    const int m0 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(n0, o0)));
+    const int m1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(n1, o1)));
+    return ~(m0 | m1 << 4) & 0xff;
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) mask |= static_cast<uint32_t>(oldp[i] != newp[i]) << i;
+    return mask;
+#endif
+}
+
+static inline uint32_t vlTraceDiffMask8(const uint32_t* oldp, const QData* newp) {
+    // The two old words of each element are in little-endian order, as in a QData
+#if defined(VL_HAVE_AVX2)
+    uint32_t eqMask = 0;
+    for (int i = 0; i < 2; ++i) {
+        const __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(newp + 4 * i));
+        const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp + 8 * i));
+        eqMask |= _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(n, o))) << (4 * i);
+    }
+    return ~eqMask & 0xff;
+#elif defined(VL_HAVE_SSE2)
+    uint32_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        const __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newp + 2 * i));
+        const __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + 4 * i));
+        // An element is unchanged only if both of its words are
+        const int eq = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(n, o)));
+        mask |= static_cast<uint32_t>((eq & 0x3) != 0x3) << (2 * i);
+        mask |= static_cast<uint32_t>((eq & 0xc) != 0xc) << (2 * i + 1);
+    }
+    return mask;
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) {
+        QData old;
+        std::memcpy(&old, oldp + 2 * i, sizeof(old));
+        mask |= static_cast<uint32_t>(old != newp[i]) << i;
+    }
+    return mask;
+#endif
+}
+
+// Call 'changed(i)' for each element 'i' of 'newp[0..n)' that differs from its
+// previous value at 'oldp', checking 8 elements at once
+template <typename T, typename T_Func>
+static inline void vlTraceChgArray(const uint32_t* oldp, const T* newp, int n, T_Func changed) {
+    constexpr int WORDS = sizeof(T) > sizeof(uint32_t) ? 2 : 1;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint32_t mask = vlTraceDiffMask8(oldp + i * WORDS, newp + i);
+        for (int j = i; VL_UNLIKELY(mask); ++j, mask >>= 1) {
+            if (mask & 1) changed(j);
+        }
+    }
+    for (; i < n; ++i) {
+        if (WORDS == 1) {
+            if (VL_UNLIKELY(oldp[i] != static_cast<uint32_t>(newp[i]))) changed(i);
+        } else {
+            QData old;
+            std::memcpy(&old, oldp + i * WORDS, sizeof(old));
+            if (VL_UNLIKELY(old != static_cast<QData>(newp[i]))) changed(i);
+        }
+    }
+}
+
+//=========================================================================
+// VerilatedTraceBuffer
 
 // These functions must write the new value back into the old value store,
 // and subsequently call the format-specific emit* implementations. Note
@@ -552,6 +908,12 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullBit(uint32_t* oldp, CData newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        m_recordRingp->putRecord(newval ? VerilatedTraceOffloadRing::CHG_BIT_1
+                                         : VerilatedTraceOffloadRing::CHG_BIT_0,
+                                  code);
+        return;
+    }
     emitBit(code, newval);
 }
 
@@ -559,13 +921,22 @@ template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEvent(uint32_t* oldp, const VlEventBase* newvalp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     // No need to update *oldp
-    if (newvalp->isTriggered()) emitEvent(code);
+    if (!newvalp->isTriggered()) return;
+    if (m_recordRingp) {
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_EVENT, code);
+        return;
+    }
+    emitEvent(code);
 }
 
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEventTriggered(uint32_t* oldp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     // No need to update *oldp
+    if (m_recordRingp) {
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_EVENT, code);
+        return;
+    }
     emitEvent(code);
 }
 
@@ -574,6 +945,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullCData(uint32_t* oldp, CData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        const uint32_t payload[2] = {static_cast<uint32_t>(bits), newval};
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_CDATA, code, payload, 2);
+        return;
+    }
     emitCData(code, newval, bits);
 }
 
@@ -582,6 +958,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullSData(uint32_t* oldp, SData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        const uint32_t payload[2] = {static_cast<uint32_t>(bits), newval};
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_SDATA, code, payload, 2);
+        return;
+    }
     emitSData(code, newval, bits);
 }
 
@@ -590,6 +971,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullIData(uint32_t* oldp, IData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        const uint32_t payload[2] = {static_cast<uint32_t>(bits), newval};
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_IDATA, code, payload, 2);
+        return;
+    }
     emitIData(code, newval, bits);
 }
 
@@ -598,6 +984,12 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullQData(uint32_t* oldp, QData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        const uint32_t payload[3] = {static_cast<uint32_t>(bits), static_cast<uint32_t>(newval),
+                                     static_cast<uint32_t>(newval >> 32)};
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_QDATA, code, payload, 3);
+        return;
+    }
     emitQData(code, newval, bits);
 }
 
@@ -606,6 +998,13 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullWData(uint32_t* oldp, WDataInP newval,
     const uint32_t code = oldp - m_sigs_oldvalp;
     for (int i = 0; i < VL_WORDS_I(bits); ++i) oldp[i] = newval[i];
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        const uint32_t payload = static_cast<uint32_t>(bits);
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_WDATA, code, &payload, 1,
+                                  VL_WORDS_I(bits));
+        for (int i = 0; i < VL_WORDS_I(bits); ++i) m_recordRingp->put(newval[i]);
+        return;
+    }
     emitWData(code, newval, bits);
 }
 
@@ -614,8 +1013,42 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullDouble(uint32_t* oldp, double newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (m_recordRingp) {
+        // The old value store holds the bits of the double
+        m_recordRingp->putRecord(VerilatedTraceOffloadRing::CHG_DOUBLE, code, oldp, 2);
+        return;
+    }
     // cppcheck-suppress invalidPointerCast
     emitDouble(code, newval);
 }
 
+template <>
+void VerilatedTraceBuffer<VL_BUF_T>::chgBitArray(uint32_t* oldp, const CData* newp, int n) {
+    vlTraceChgArray(oldp, newp, n, [&](int i) { fullBit(oldp + i, newp[i]); });
+}
+
+template <>
+void VerilatedTraceBuffer<VL_BUF_T>::chgCDataArray(uint32_t* oldp, const CData* newp, int n,
+                                                   int bits) {
+    vlTraceChgArray(oldp, newp, n, [&](int i) { fullCData(oldp + i, newp[i], bits); });
+}
+
+template <>
+void VerilatedTraceBuffer<VL_BUF_T>::chgSDataArray(uint32_t* oldp, const SData* newp, int n,
+                                                   int bits) {
+    vlTraceChgArray(oldp, newp, n, [&](int i) { fullSData(oldp + i, newp[i], bits); });
+}
+
+template <>
+void VerilatedTraceBuffer<VL_BUF_T>::chgIDataArray(uint32_t* oldp, const IData* newp, int n,
+                                                   int bits) {
+    vlTraceChgArray(oldp, newp, n, [&](int i) { fullIData(oldp + i, newp[i], bits); });
+}
+
+template <>
+void VerilatedTraceBuffer<VL_BUF_T>::chgQDataArray(uint32_t* oldp, const QData* newp, int n,
+                                                   int bits) {
+    vlTraceChgArray(oldp, newp, n, [&](int i) { fullQData(oldp + 2 * i, newp[i], bits); });
+}
+
 #endif  // VL_CPPCHECK
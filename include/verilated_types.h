@@ -1846,6 +1846,64 @@ struct VlApplyIndices<N_Rank, N_Rank, T_Target> final {
 //   derived from the bit selects (_[3:1]), which masks the bits that
 //   need to be updated, and additionally the RHS is widened to a full
 //   element size, with the bits inserted into the masked region.
+// Both specializations also provide 'commitSorted', which Verilator uses
+// instead of 'commit' when the same elements are likely to be written
+// multiple times per evaluation (e.g. memories with multiple write ports,
+// or byte enables in a loop). This applies the updates in index order,
+// and writes each element only once, with the combined effect of all
+// updates to that element in program order (i.e.: last writer wins).
+// Helpers for 'commitSorted' in VlNBACommitQueue below
+
+template <std::size_t N_Rank>
+struct VlNBACommitSort final {
+    // Below this many pending updates 'commitSorted' does a plain 'commit', as sorting is not
+    // worth it
+    static constexpr size_t MIN_PENDING = 8;
+
+    // Whether the two entries update the same element
+    template <typename T_Entry>
+    VL_ATTR_ALWINLINE static bool sameIndices(const T_Entry& a, const T_Entry& b) {
+        for (size_t i = 0; i < N_Rank; ++i) {
+            if (a.indices[i] != b.indices[i]) return false;
+        }
+        return true;
+    }
+
+    // Compute in 'order' the positions of entries in 'pending' (in the low 32 bits of each
+    // element, see 'position'), sorted by indices, and in program order for the same indices
+    template <typename T_Entry>
+    static void sort(const std::vector<T_Entry>& pending, std::vector<uint64_t>& order) {
+        const uint32_t size = static_cast<uint32_t>(pending.size());
+        order.resize(size);
+        if (N_Rank == 1) {
+            // Common case of a 1D array: sort plain integers of the index and the position
+            bool fits = true;
+            for (uint32_t i = 0; i < size; ++i) {
+                const size_t index = pending[i].indices[0];
+                fits &= (index >> 32) == 0;
+                order[i] = (static_cast<uint64_t>(index) << 32) | i;
+            }
+            if (VL_LIKELY(fits)) {
+                std::sort(order.begin(), order.end());
+                return;
+            }
+        }
+        for (uint32_t i = 0; i < size; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&pending](uint64_t a, uint64_t b) {
+            const size_t* const aIndicesp = pending[a].indices;
+            const size_t* const bIndicesp = pending[b].indices;
+            for (size_t i = 0; i < N_Rank; ++i) {
+                if (aIndicesp[i] != bIndicesp[i]) return aIndicesp[i] < bIndicesp[i];
+            }
+            return a < b;
+        });
+    }
+    // Position in 'pending' of an element of 'order' computed by 'sort'
+    VL_ATTR_ALWINLINE static uint32_t position(uint64_t key) {
+        return static_cast<uint32_t>(key);
+    }
+};
+
 template <typename T_Target,  // Type of the variable this commit queue updates
           bool Partial,  // Whether partial element updates are necessary
           // The following we could figure out from 'T_Target using type traits, but passing
@@ -1866,6 +1924,7 @@ class VlNBACommitQueue<T_Target, /* Partial: */ false, T_Element, N_Rank> final
 
     // STATE
     std::vector<Entry> m_pending;  // Pending updates, in program order
+    std::vector<uint64_t> m_order;  // Scratch for 'commitSorted', see VlNBACommitSort
 
 public:
     // CONSTRUCTOR
@@ -1875,7 +1934,13 @@ public:
     // METHODS
     template <typename... T_Args>
     void enqueue(const T_Element& value, T_Args... indices) {
-        m_pending.emplace_back(Entry{value, {indices...}});
+        const Entry entry{value, {static_cast<size_t>(indices)...}};
+        // Consecutive updates of the same element: the later one wins
+        if (!m_pending.empty() && VlNBACommitSort<N_Rank>::sameIndices(m_pending.back(), entry)) {
+            m_pending.back().value = value;
+            return;
+        }
+        m_pending.emplace_back(entry);
     }
 
     // Note: T_Commit might be different from T_Target. Specifically, when the signal is a
@@ -1888,6 +1953,28 @@ public:
         }
         m_pending.clear();
     }
+
+    // As 'commit', but only the last update of each element is applied, in index order
+    template <typename T_Commit>
+    void commitSorted(T_Commit& target) {
+        using Sort = VlNBACommitSort<N_Rank>;
+        if (m_pending.size() < Sort::MIN_PENDING) {
+            commit(target);
+            return;
+        }
+        Sort::sort(m_pending, m_order);
+        const size_t size = m_order.size();
+        for (size_t i = 0; i < size; ++i) {
+            const Entry& entry = m_pending[Sort::position(m_order[i])];
+            // Skip all but the last update in program order to the same element
+            if (i + 1 < size
+                && Sort::sameIndices(entry, m_pending[Sort::position(m_order[i + 1])])) {
+                continue;
+            }
+            VlApplyIndices<0, N_Rank, T_Commit>::apply(target, entry.indices) = entry.value;
+        }
+        m_pending.clear();
+    }
 };
 
 // With partial element updates
@@ -1902,6 +1989,7 @@ class VlNBACommitQueue<T_Target, /* Partial: */ true, T_Element, N_Rank> final {
 
     // STATE
     std::vector<Entry> m_pending;  // Pending updates, in program order
+    std::vector<uint64_t> m_order;  // Scratch for 'commitSorted', see VlNBACommitSort
 
     // STATIC METHODS
 
@@ -1960,7 +2048,15 @@ public:
     // METHODS
     template <typename... T_Args>
     void enqueue(const T_Element& value, const T_Element& mask, T_Args... indices) {
-        m_pending.emplace_back(Entry{value, mask, {indices...}});
+        const Entry entry{value, mask, {static_cast<size_t>(indices)...}};
+        // Consecutive updates of the same element (e.g.: byte enables in a loop): merge them
+        if (!m_pending.empty() && VlNBACommitSort<N_Rank>::sameIndices(m_pending.back(), entry)) {
+            Entry& back = m_pending.back();
+            back.value = bOr(bAnd(value, mask), bAnd(back.value, bNot(mask)));
+            back.mask = bOr(back.mask, mask);
+            return;
+        }
+        m_pending.emplace_back(entry);
     }
 
     // Note: T_Commit might be different from T_Target. Specifically, when the signal is a
@@ -1976,6 +2072,35 @@ public:
         }
         m_pending.clear();
     }
+
+    // As 'commit', but updates to the same element are merged, and applied in index order
+    template <typename T_Commit>
+    void commitSorted(T_Commit& target) {
+        using Sort = VlNBACommitSort<N_Rank>;
+        if (m_pending.size() < Sort::MIN_PENDING) {
+            commit(target);
+            return;
+        }
+        Sort::sort(m_pending, m_order);
+        const size_t size = m_order.size();
+        size_t i = 0;
+        while (i < size) {
+            const Entry& first = m_pending[Sort::position(m_order[i])];
+            T_Element value = first.value;
+            T_Element mask = first.mask;
+            // Merge later updates in program order to the same element
+            for (++i; i < size; ++i) {
+                const Entry& entry = m_pending[Sort::position(m_order[i])];
+                if (!Sort::sameIndices(first, entry)) break;
+                value = bOr(bAnd(entry.value, entry.mask), bAnd(value, bNot(entry.mask)));
+                mask = bOr(mask, entry.mask);
+            }
+            auto& ref = VlApplyIndices<0, N_Rank, T_Commit>::apply(target, first.indices);
+            const auto oldValue = ref;
+            ref = bOr(bAnd(value, mask), bAnd(oldValue, bNot(mask)));
+        }
+        m_pending.clear();
+    }
 };
 
 //===================================================================
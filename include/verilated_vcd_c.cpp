@@ -106,6 +106,8 @@ VerilatedVcd::VerilatedVcd(VerilatedVcdFile* filep) {
 
 void VerilatedVcd::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
+    // The writer thread may be rolling over to the next file; wait for it
+    Super::flushBase();
     if (isOpen()) return;
 
     // Set member variables
@@ -136,6 +138,7 @@ void VerilatedVcd::openNext(bool incFilename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     // Open next filename in concat sequence, mangle filename if
     // incFilename is true.
     const VerilatedLockGuard lock{m_mutex};
+    Super::flushBase();
     openNextImp(incFilename);
 }
 
@@ -238,10 +241,13 @@ void VerilatedVcd::closeErr() {
 void VerilatedVcd::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     // This function is on the flush() call path
     const VerilatedLockGuard lock{m_mutex};
-    if (!isOpen()) return;
-    closePrev();
+    // The writer thread may be rolling over to the next file; wait for it
+    // before looking at the file
+    Super::flushBase();
+    if (isOpen()) closePrev();
     // closePrev() called Super::flush(), so we just
-    // need to shut down the tracing thread here.
+    // need to shut down the tracing thread here. This is also needed if the
+    // tracing thread failed to open the next file.
     Super::closeBase();
 }
 
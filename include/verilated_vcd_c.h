@@ -47,7 +47,8 @@ private:
 
     VerilatedVcdFile* m_filep;  // File we're writing to
     bool m_fileNewed;  // m_filep needs destruction
-    bool m_isOpen = false;  // True indicates open file
+    // True indicates open file. Atomic as with --trace-offload the writer thread rolls over
+    std::atomic<bool> m_isOpen{false};
     std::string m_filename;  // Filename we're writing to (if open)
     uint64_t m_rolloverSize = 0;  // File size to rollover at
     int m_indent = 0;  // Indentation depth
@@ -201,6 +202,10 @@ template <>
 void VerilatedVcd::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedVcd::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVcd::Super::triggerHistory(uint64_t dumps);
+template <>
+void VerilatedVcd::Super::trigger();
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -329,6 +334,12 @@ public:
     void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
     void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    /// Hold back at least the last 'dumps' calls to dump() in memory, and
+    /// write them only on trigger(), or on $stop, $fatal or a failed assertion.
+    /// Zero stops holding back, discarding the dumps held so far.
+    void triggerHistory(uint64_t dumps) VL_MT_SAFE { m_sptrace.triggerHistory(dumps); }
+    /// Write the held back dumps, then continue writing each dump as usual
+    void trigger() VL_MT_SAFE { m_sptrace.trigger(); }
 
     // METHODS - Internal/backward compatible
     // \protectedsection
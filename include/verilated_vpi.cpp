@@ -43,6 +43,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -382,7 +383,6 @@ public:
 };
 
 class VerilatedVpioVar VL_NOT_FINAL : public VerilatedVpioVarBase {
-    uint8_t* m_prevDatap = nullptr;  // Previous value of data, for cbValueChange
     uint32_t m_entSize = 0;  // memoized variable size
     uint32_t m_bitOffset = 0;
     int32_t m_partselBits = -1;  // Part-select width, -1 means no part-select active
@@ -420,12 +420,9 @@ public:
             m_fullNameOverride = vop->m_fullNameOverride;
             m_partselBits = vop->m_partselBits;
             m_bitOffset = vop->m_bitOffset;
-            // Not copying m_prevDatap, must be nullptr
         }
     }
-    ~VerilatedVpioVar() override {
-        if (m_prevDatap) VL_DO_CLEAR(delete[] m_prevDatap, m_prevDatap = nullptr);
-    }
+    ~VerilatedVpioVar() override = default;
     // cppcheck-suppress duplInheritedMember
     static VerilatedVpioVar* castp(vpiHandle h) {
         return dynamic_cast<VerilatedVpioVar*>(reinterpret_cast<VerilatedVpio*>(h));
@@ -539,14 +536,7 @@ public:
         for (auto idx : index()) m_fullname += "[" + std::to_string(idx) + "]";
         return m_fullname.c_str();
     }
-    void* prevDatap() const { return m_prevDatap; }
     void* varDatap() const override { return m_varDatap; }
-    void createPrevDatap() {
-        if (VL_UNLIKELY(!m_prevDatap)) {
-            m_prevDatap = new uint8_t[entSize()];
-            std::memcpy(prevDatap(), m_varDatap, entSize());
-        }
-    }
 };
 
 class VerilatedVpioVarIter final : public VerilatedVpio {
@@ -688,14 +678,15 @@ public:
     vpiHandle dovpi_scan() override {
         if (VL_UNLIKELY(!m_varsp)) return atEnd();
         if (VL_UNLIKELY(!m_started)) {
-            m_it = m_varsp->begin();
+            // Members are the variables named with the struct's prefix
+            m_it = m_varsp->prefixBegin(m_namePrefix.c_str());
             m_started = true;
         } else if (VL_LIKELY(m_it != m_varsp->end())) {
             ++m_it;
         }
         for (; m_it != m_varsp->end(); ++m_it) {
             const char* const name = m_it->second.name();
-            if (std::strncmp(name, m_namePrefix.c_str(), m_namePrefix.length()) != 0) continue;
+            if (std::strncmp(name, m_namePrefix.c_str(), m_namePrefix.length()) != 0) break;
             // Only direct members, not grandchildren
             if (_vl_vpi_find_unescaped_dot(name + m_namePrefix.length())) continue;
             VerilatedVpioVar* const memberp = m_varp->withMember(&(m_it->second));
@@ -857,7 +848,6 @@ public:
         m_cbData.value = &m_value;
         if (varop) {
             m_cbData.obj = m_varo.castVpiHandle();
-            m_varo.createPrevDatap();
         } else {
             m_cbData.obj = nullptr;
         }
@@ -868,6 +858,66 @@ public:
     uint64_t id() const { return m_id; }
     bool invalid() const { return !m_id; }
     void invalidate() { m_id = 0; }
+    VerilatedVpioVar* varop() { return &m_varo; }
+};
+
+class VerilatedVpiValueWatch final {
+    // Storage of a variable watched by cbValueChange callbacks. All callbacks
+    // on the same storage share one copy of the previous value, so each
+    // variable is compared once per callValueCbs no matter how many callbacks
+    // are registered on it, and callbacks are only visited when it changed.
+    void* const m_datap;  // Watched storage
+    const uint32_t m_entSize;  // Bytes of watched storage
+    const std::unique_ptr<uint8_t[]> m_prevDatap;  // Value when last compared
+    std::list<VerilatedVpiCbHolder> m_cbs;  // Callbacks on this storage
+    size_t m_index = 0;  // Position in VerilatedVpiImp::m_valueWatches
+
+public:
+    VerilatedVpiValueWatch(void* datap, uint32_t entSize)
+        : m_datap{datap}
+        , m_entSize{entSize}
+        , m_prevDatap{new uint8_t[entSize]} {
+        std::memcpy(m_prevDatap.get(), m_datap, m_entSize);
+    }
+    ~VerilatedVpiValueWatch() = default;
+    VL_UNCOPYABLE(VerilatedVpiValueWatch);
+    void* datap() const { return m_datap; }
+    uint32_t entSize() const { return m_entSize; }
+    std::list<VerilatedVpiCbHolder>& cbs() { return m_cbs; }
+    size_t index() const { return m_index; }
+    void index(size_t index) { m_index = index; }
+    // True if the storage still holds the value last compared against
+    bool unchanged() const { return std::memcmp(m_prevDatap.get(), m_datap, m_entSize) == 0; }
+    // Compare against the previous value, remembering the current value
+    bool changed() {
+        switch (m_entSize) {  // Avoid the memcmp call for scalar variables
+        case 1: return changedWord<uint8_t>();
+        case 2: return changedWord<uint16_t>();
+        case 4: return changedWord<uint32_t>();
+        case 8: return changedWord<uint64_t>();
+        default:
+            if (VL_LIKELY(unchanged())) return false;
+            std::memcpy(m_prevDatap.get(), m_datap, m_entSize);
+            return true;
+        }
+    }
+    // Remove callbacks that were invalidated, return true if none remain
+    bool cleanup() {
+        m_cbs.remove_if([](const VerilatedVpiCbHolder& ho) { return ho.invalid(); });
+        return m_cbs.empty();
+    }
+
+private:
+    template <typename T_Word>
+    bool changedWord() {
+        T_Word prev;
+        T_Word curr;
+        std::memcpy(&prev, m_prevDatap.get(), sizeof(T_Word));
+        std::memcpy(&curr, m_datap, sizeof(T_Word));
+        if (VL_LIKELY(prev == curr)) return false;
+        std::memcpy(m_prevDatap.get(), &curr, sizeof(T_Word));
+        return true;
+    }
 };
 
 class VerilatedVpiPutHolder final {
@@ -1038,6 +1088,14 @@ class VerilatedVpiImp final {
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    // cbValueChange callbacks, grouped by watched storage
+    std::vector<std::unique_ptr<VerilatedVpiValueWatch>> m_valueWatches;
+    std::unordered_multimap<const void*, VerilatedVpiValueWatch*> m_valueWatchesByData;
+    std::unordered_map<uint64_t, VerilatedVpiValueWatch*> m_valueCbWatches;  // Id to watch
+    std::vector<VerilatedVpiValueWatch*> m_valueChanged;  // Temporary for callValueCbs
+    std::vector<VerilatedVpiCbHolder*> m_valueCalls;  // Temporary for callValueCbs
+    std::vector<VerilatedVpiValueWatch*> m_valueCleanups;  // Watches with removed callbacks
+    bool m_valueCalling = false;  // Inside callValueCbs
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
@@ -1060,9 +1118,63 @@ public:
         }
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " obj=%p\n",
                                     cb_data_p->reason, id, cb_data_p->obj););
-        VerilatedVpioVar* varop = nullptr;
-        if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
-        s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
+        if (cb_data_p->reason == cbValueChange) {
+            valueCbAdd(id, cb_data_p);
+            return;
+        }
+        s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, nullptr);
+    }
+    static void valueCbAdd(uint64_t id, const s_cb_data* cb_data_p) {
+        VerilatedVpioVar* const varop = VerilatedVpioVar::castp(cb_data_p->obj);
+        void* const datap = varop->varDatap();
+        const uint32_t entSize = varop->entSize();
+        // Share a watch that already has the current value, so the new callback
+        // only sees changes made after it was registered
+        VerilatedVpiValueWatch* watchp = nullptr;
+        const auto range = s().m_valueWatchesByData.equal_range(datap);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->entSize() == entSize && it->second->unchanged()) {
+                watchp = it->second;
+                break;
+            }
+        }
+        if (!watchp) {
+            watchp = new VerilatedVpiValueWatch{datap, entSize};
+            watchp->index(s().m_valueWatches.size());
+            s().m_valueWatches.emplace_back(watchp);
+            s().m_valueWatchesByData.emplace(datap, watchp);
+        }
+        watchp->cbs().emplace_back(id, cb_data_p, varop);
+        s().m_valueCbWatches.emplace(id, watchp);
+    }
+    static void valueCbRemove(uint64_t id) {
+        const auto it = s().m_valueCbWatches.find(id);
+        if (it == s().m_valueCbWatches.end()) return;
+        VerilatedVpiValueWatch* const watchp = it->second;
+        s().m_valueCbWatches.erase(it);
+        for (VerilatedVpiCbHolder& ho : watchp->cbs()) {
+            if (ho.id() == id) ho.invalidate();
+        }
+        if (s().m_valueCalling) {  // Holders may be pending a call, erase after
+            s().m_valueCleanups.push_back(watchp);
+        } else {
+            valueWatchCleanup(watchp);
+        }
+    }
+    static void valueWatchCleanup(VerilatedVpiValueWatch* watchp) {
+        if (!watchp->cleanup()) return;
+        // No callbacks remain, stop watching
+        const auto range = s().m_valueWatchesByData.equal_range(watchp->datap());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == watchp) {
+                s().m_valueWatchesByData.erase(it);
+                break;
+            }
+        }
+        const size_t index = watchp->index();
+        std::swap(s().m_valueWatches[index], s().m_valueWatches.back());
+        s().m_valueWatches[index]->index(index);
+        s().m_valueWatches.pop_back();  // Deletes watchp
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -1084,6 +1196,10 @@ public:
         // Id might no longer exist, if already removed due to call after event, or teardown
         // We do not remove it now as we may be iterating the list,
         // instead set to nullptr and will cleanup later
+        if (reason == cbValueChange) {
+            valueCbRemove(id);
+            return;
+        }
         // Remove from cbCurrent queue
         for (auto& ir : s().m_cbCurrentLists[reason]) {
             if (ir.id() == id) {
@@ -1146,6 +1262,7 @@ public:
         return ~0ULL;  // maxquad
     }
     static bool hasCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
+        if (reason == cbValueChange) return !s().m_valueCbWatches.empty();
         return !s().m_cbCurrentLists[reason].empty();
     }
     static bool callCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
@@ -1171,41 +1288,44 @@ public:
     }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
-        bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
-        if (cbObjList.empty()) return called;
-        const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
-        for (auto it = cbObjList.begin(); true;) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
-            const bool was_last = it == last;
-            if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
-                it = cbObjList.erase(it);
-                if (was_last) break;
-                continue;
-            }
-            VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
-            void* const newDatap = varop->varDatap();
-            void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
-            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
-                                        varop->fullname(), *(static_cast<CData*>(newDatap)),
-                                        *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
-                                            ho.id(), varop->fullname(),
-                                            *(static_cast<CData*>(newDatap))););
-                update.insert(varop);
-                vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
-                (ho.cb_rtnp())(ho.cb_datap());
-                called = true;
+        if (s().m_valueWatches.empty()) return false;
+        // Compare each watched variable once; only changed ones have callbacks visited
+        std::vector<VerilatedVpiValueWatch*>& changed = s().m_valueChanged;
+        for (const auto& watchp : s().m_valueWatches) {
+            if (VL_UNLIKELY(watchp->changed())) changed.push_back(watchp.get());
+        }
+        if (VL_LIKELY(changed.empty())) return false;
+        // Callbacks registered from here on are not called until the next change
+        std::vector<VerilatedVpiCbHolder*>& calls = s().m_valueCalls;
+        for (VerilatedVpiValueWatch* const watchp : changed) {
+            for (VerilatedVpiCbHolder& ho : watchp->cbs()) {
+                if (VL_LIKELY(!ho.invalid())) calls.push_back(&ho);
             }
-            if (was_last) break;
         }
-        for (const VerilatedVpioVar* const ip : update) {
-            std::memcpy(ip->prevDatap(), ip->varDatap(), ip->entSize());
+        changed.clear();
+        // Call in registration order
+        std::sort(calls.begin(), calls.end(),
+                  [](const VerilatedVpiCbHolder* ap, const VerilatedVpiCbHolder* bp) {
+                      return ap->id() < bp->id();
+                  });
+        bool called = false;
+        s().m_valueCalling = true;
+        for (VerilatedVpiCbHolder* const hop : calls) {
+            if (VL_UNLIKELY(hop->invalid())) continue;  // Removed by an earlier callback
+            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
+                                        hop->id(), hop->varop()->fullname(),
+                                        *(static_cast<CData*>(hop->varop()->varDatap()))););
+            vpi_get_value(hop->cb_datap()->obj, hop->cb_datap()->value);
+            (hop->cb_rtnp())(hop->cb_datap());
+            called = true;
         }
+        s().m_valueCalling = false;
+        calls.clear();
+        std::vector<VerilatedVpiValueWatch*> cleanups;
+        std::swap(cleanups, s().m_valueCleanups);
+        std::sort(cleanups.begin(), cleanups.end());
+        cleanups.erase(std::unique(cleanups.begin(), cleanups.end()), cleanups.end());
+        for (VerilatedVpiValueWatch* const watchp : cleanups) valueWatchCleanup(watchp);
         return called;
     }
     static void dumpCbs() VL_MT_UNSAFE_ONE;
@@ -1361,6 +1481,120 @@ bool VerilatedVpi::evalNeeded() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::evalN
 
 void VerilatedVpi::doInertialPuts() VL_MT_UNSAFE_ONE { VerilatedVpiImp::doInertialPuts(); }
 
+//======================================================================
+// VerilatedVpiBatch implementation
+
+bool VerilatedVpiBatch::add(vpiHandle handle) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(handle);
+    if (VL_UNLIKELY(!vop)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p), not a variable",
+                      __func__, handle);
+        return false;
+    }
+    const VerilatedVarType vltype = vop->varp()->vltype();
+    const bool typeOk = (vltype >= VLVT_UINT8 && vltype <= VLVT_WDATA) || vltype == VLVT_REAL;
+    if (VL_UNLIKELY(!typeOk || vop->isIndexedDimUnpacked() || vop->bitOffset()
+                    || vop->partselBits() >= 0)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Unsupported variable '%s', must be a whole packed or real variable,"
+                      " or unpacked array element",
+                      __func__, vop->fullname());
+        return false;
+    }
+    Entry entry;
+    entry.datap = static_cast<uint8_t*>(vop->varDatap());
+    entry.size = vltype == VLVT_REAL ? sizeof(double) : vop->entSize();
+    entry.bits = vop->bitSize();
+    entry.vltype = vltype;
+    entry.writable = vop->varp()->isPublicRW() && !vop->varp()->isForceable();
+    if (vop->varp()->isForceable()) {
+        // Reads see the forced value, as in vpi_get_value
+        const auto forceControlSignals = VerilatedVpiImp::getForceControlSignals(vop);
+        if (VL_UNLIKELY(!forceControlSignals.forceRead)) return false;  // LCOV_EXCL_LINE
+        entry.datap = static_cast<uint8_t*>(forceControlSignals.forceRead->varDatap());
+    }
+    const size_t align
+        = vltype == VLVT_REAL ? sizeof(double) : VerilatedVpiImp::vlTypeSize(vltype);
+    entry.offset = (m_bufferSize + align - 1) / align * align;
+    m_bufferSize = entry.offset + entry.size;
+    if (!entry.writable) ++m_readOnly;
+    m_entries.push_back(entry);
+    // Extend the previous run when both storage and buffer are contiguous,
+    // e.g. consecutive elements of an unpacked array
+    if (!m_runs.empty()) {
+        Run& run = m_runs.back();
+        if (run.datap + run.size == entry.datap && run.offset + run.size == entry.offset) {
+            run.size += entry.size;
+            return true;
+        }
+    }
+    m_runs.push_back(Run{entry.datap, entry.offset, entry.size});
+    return true;
+}
+
+void VerilatedVpiBatch::getValues(void* bufferp) const VL_MT_UNSAFE_ONE {
+    uint8_t* const bufp = static_cast<uint8_t*>(bufferp);
+    for (const Run& run : m_runs) std::memcpy(bufp + run.offset, run.datap, run.size);
+}
+
+bool VerilatedVpiBatch::putValues(const void* bufferp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (VL_UNLIKELY(m_readOnly)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Batch contains %zu read-only or forceable variable(s),"
+                      " use vpi_put_value for these",
+                      __func__, m_readOnly);
+        return false;
+    }
+    const uint8_t* const bufp = static_cast<const uint8_t*>(bufferp);
+    for (const Entry& entry : m_entries) {
+        const uint8_t* const srcp = bufp + entry.offset;
+        // Values are stored with unused upper bits clear, so mask the top word
+        switch (entry.vltype) {
+        case VLVT_UINT8: {
+            CData value;
+            std::memcpy(&value, srcp, sizeof(value));
+            value &= VL_MASK_I(entry.bits);
+            std::memcpy(entry.datap, &value, sizeof(value));
+            break;
+        }
+        case VLVT_UINT16: {
+            SData value;
+            std::memcpy(&value, srcp, sizeof(value));
+            value &= VL_MASK_I(entry.bits);
+            std::memcpy(entry.datap, &value, sizeof(value));
+            break;
+        }
+        case VLVT_UINT32: {
+            IData value;
+            std::memcpy(&value, srcp, sizeof(value));
+            value &= VL_MASK_I(entry.bits);
+            std::memcpy(entry.datap, &value, sizeof(value));
+            break;
+        }
+        case VLVT_UINT64: {
+            QData value;
+            std::memcpy(&value, srcp, sizeof(value));
+            value &= VL_MASK_Q(entry.bits);
+            std::memcpy(entry.datap, &value, sizeof(value));
+            break;
+        }
+        case VLVT_WDATA: {
+            std::memcpy(entry.datap, srcp, entry.size);
+            EData* const wordsp = reinterpret_cast<EData*>(entry.datap);
+            wordsp[VL_WORDS_I(entry.bits) - 1] &= VL_MASK_E(entry.bits);
+            break;
+        }
+        default: std::memcpy(entry.datap, srcp, entry.size); break;  // VLVT_REAL
+        }
+    }
+    if (!m_entries.empty()) VerilatedVpiImp::evalNeeded(true);
+    return true;
+}
+
 //======================================================================
 // VerilatedVpiImp implementation
 
@@ -1376,6 +1610,15 @@ void VerilatedVpiImp::dumpCbs() VL_MT_UNSAFE_ONE {
             }
         }
     }
+    for (const auto& watchp : s().m_valueWatches) {
+        for (const VerilatedVpiCbHolder& ho : watchp->cbs()) {
+            if (VL_UNLIKELY(!ho.invalid())) {
+                VL_DBG_MSGF("- vpi:   reason=%d=%s  id=%" PRId64 " data=%p\n", cbValueChange,
+                            VerilatedVpiError::strFromVpiCallbackReason(cbValueChange), ho.id(),
+                            watchp->datap());
+            }
+        }
+    }
     for (auto& ifuture : s().m_nextCbs) {
         const QData time = ifuture.first.first;
         VerilatedVpiCbHolder& ho = ifuture.second;
@@ -2669,13 +2912,127 @@ _vl_vpi_handle_dotted_indexed_member_by_name(const std::string& scopeAndName) {
 
 // for obtaining handles
 
+// Result of resolving a name in vpi_handle_by_name, kept by VerilatedVpiNameCache.
+struct VerilatedVpiNameEntry final {
+    const VerilatedScope* scopep = nullptr;  // Scope found, or scope containing varp
+    const VerilatedVar* varp = nullptr;  // Variable found, nullptr if name is a scope
+    std::string fullnameOverride;  // Full name of a synthetic struct member variable
+    std::vector<PLI_INT32> indices;  // Array indices to apply to varp
+    VlVpiBitRange bitRange;  // Part select to apply after indices
+};
+
+//======================================================================
+// VerilatedVpiNameCache
+// Names already resolved by vpi_handle_by_name, so repeated lookups of the same
+// path skip the hierarchy split, index parsing and scope/variable searches.
+// Entries point into the model's symbol table, so are dropped whenever scopes
+// are created or destroyed, or a different context is used.
+
+class VerilatedVpiNameCache final {
+    // Bound on entries, so walking e.g. every element of a large memory by name
+    // does not grow the cache without limit
+    static constexpr size_t MAX_ENTRIES = 1 << 16;
+    std::unordered_map<std::string, VerilatedVpiNameEntry> m_entries;
+    const VerilatedContext* m_contextp = nullptr;  // Context entries were resolved in
+    uint64_t m_generation = 0;  // Context's scope generation entries were resolved at
+
+    static VerilatedVpiNameCache& s() {  // Singleton
+        static VerilatedVpiNameCache s_s;
+        return s_s;
+    }
+
+public:
+    // Return cached resolution of name, or nullptr if not cached
+    static const VerilatedVpiNameEntry* find(const std::string& name) {
+        VerilatedVpiNameCache& c = s();
+        const VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = contextp->scopesGeneration();
+        if (VL_UNLIKELY(contextp != c.m_contextp || generation != c.m_generation)) {
+            c.m_entries.clear();
+            c.m_contextp = contextp;
+            c.m_generation = generation;
+            return nullptr;
+        }
+        const auto it = c.m_entries.find(name);
+        if (it == c.m_entries.end()) return nullptr;
+        return &it->second;
+    }
+    // Add resolution of name; must follow a find() of the same name
+    static const VerilatedVpiNameEntry& insert(const std::string& name,
+                                               VerilatedVpiNameEntry&& entry) {
+        VerilatedVpiNameCache& c = s();
+        if (VL_UNLIKELY(c.m_entries.size() >= MAX_ENTRIES)) c.m_entries.clear();
+        return c.m_entries.emplace(name, std::move(entry)).first->second;
+    }
+};
+
+// Create a new handle for a resolved name
+static vpiHandle _vl_vpi_handle_by_name_entry(const VerilatedVpiNameEntry& entry) {
+    const VerilatedScope* const scopep = entry.scopep;
+    const VerilatedVar* const varp = entry.varp;
+    if (!varp) {  // Whole thing found as a scope
+        if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
+            return (new VerilatedVpioModule{scopep})->castVpiHandle();
+        }
+        if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
+            return (new VerilatedVpioPackage{scopep})->castVpiHandle();
+        }
+        return (new VerilatedVpioScope{scopep})->castVpiHandle();
+    }
+
+    // Create the initial variable handle
+    vpiHandle resultHandle;
+    if (varp->isParam()) {
+        resultHandle = (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
+    } else if (!entry.fullnameOverride.empty()) {
+        resultHandle = (new VerilatedVpioVar{varp, scopep, varp->datap(),
+                                             _vl_vpi_member_local_name(varp->name()),
+                                             entry.fullnameOverride})
+                           ->castVpiHandle();
+    } else {
+        resultHandle = (new VerilatedVpioVar{varp, scopep})->castVpiHandle();
+    }
+
+    // If we have indices, apply them using vpi_handle_by_multi_index
+    if (!entry.indices.empty()) {
+        static thread_local std::vector<PLI_INT32> indices;
+        indices = entry.indices;
+        vpiHandle indexedHandle = vpi_handle_by_multi_index(
+            resultHandle, static_cast<PLI_INT32>(indices.size()), indices.data());
+        vpi_release_handle(resultHandle);
+        resultHandle = indexedHandle;
+        if (!resultHandle) return nullptr;
+    }
+
+    // If we have a bit range part-select, apply it
+    if (entry.bitRange.valid) {
+        VerilatedVpioVar* const varop = VerilatedVpioVar::castp(resultHandle);
+        if (!varop) {
+            vpi_release_handle(resultHandle);
+            return nullptr;
+        }
+        VerilatedVpioVar* const partsel
+            = varop->withPartSelect(entry.bitRange.hi, entry.bitRange.lo);
+        if (!partsel) {
+            vpi_release_handle(resultHandle);
+            return nullptr;
+        }
+        vpi_release_handle(resultHandle);
+        resultHandle = partsel->castVpiHandle();
+    }
+
+    return resultHandle;
+}
+
 vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     VerilatedVpiImp::assertOneCheck();
     VL_VPI_ERROR_RESET_();
     if (VL_UNLIKELY(!namep)) return nullptr;
     VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_handle_by_name %s %p\n", namep, scope););
 
-    std::string scopeAndName = namep;
+    // Reused across calls so a cached lookup does not allocate
+    static thread_local std::string scopeAndName;
+    scopeAndName = namep;
 
     // Collapse consecutive spaces into single spaces (can occur with escaped identifiers)
     scopeAndName.erase(std::unique(scopeAndName.begin(), scopeAndName.end(),
@@ -2696,14 +3053,18 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
         scopeAndName.erase(0, std::strlen("$root."));
     } else if (voScopep) {
         const bool scopeIsPackage = VerilatedVpioPackage::castp(scope) != nullptr;
-        scopeAndName
-            = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + scopeAndName;
+        if (!scopeIsPackage) scopeAndName.insert(0, 1, '.');
+        scopeAndName.insert(0, voScopep->fullname());
     } else if (voVarp && voVarp->isStructOrUnion()) {
         if (VerilatedVpioVar* const memberp
             = _vl_vpi_handle_member_by_name(scopeAndName, voVarp)) {
             return memberp->castVpiHandle();
         }
-        scopeAndName = std::string{voVarp->fullname()} + "." + scopeAndName;
+        scopeAndName.insert(0, 1, '.');
+        scopeAndName.insert(0, voVarp->fullname());
+    }
+    if (const VerilatedVpiNameEntry* const entryp = VerilatedVpiNameCache::find(scopeAndName)) {
+        return _vl_vpi_handle_by_name_entry(*entryp);
     }
     {
         // This doesn't yet follow the hierarchy in the proper way
@@ -2713,13 +3074,10 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
         // interpreting the trailing brackets as array indices or bit selects.
         scopep = Verilated::threadContextp()->scopeFind(scopeAndName.c_str());
         if (scopep) {  // Whole thing found as a scope
-            if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
-            }
-            if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            }
-            return (new VerilatedVpioScope{scopep})->castVpiHandle();
+            VerilatedVpiNameEntry entry;
+            entry.scopep = scopep;
+            return _vl_vpi_handle_by_name_entry(
+                VerilatedVpiNameCache::insert(scopeAndName, std::move(entry)));
         }
         std::string basename = scopeAndName;
         std::string scopename;
@@ -2778,45 +3136,14 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     }
     if (!varp) return nullptr;
 
-    // Create the initial variable handle
-    vpiHandle resultHandle;
-    if (varp->isParam()) {
-        resultHandle = (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
-    } else if (!fullnameOverride.empty()) {
-        resultHandle
-            = (new VerilatedVpioVar{varp, scopep, varp->datap(),
-                                    _vl_vpi_member_local_name(varp->name()), fullnameOverride})
-                  ->castVpiHandle();
-    } else {
-        resultHandle = (new VerilatedVpioVar{varp, scopep})->castVpiHandle();
-    }
-
-    // If we have indices, apply them using vpi_handle_by_multi_index
-    if (hasIndices && !indices.empty()) {
-        vpiHandle indexedHandle = vpi_handle_by_multi_index(
-            resultHandle, static_cast<PLI_INT32>(indices.size()), indices.data());
-        vpi_release_handle(resultHandle);
-        resultHandle = indexedHandle;
-        if (!resultHandle) return nullptr;
-    }
-
-    // If we have a bit range part-select, apply it
-    if (bitRange.valid) {
-        VerilatedVpioVar* const varop = VerilatedVpioVar::castp(resultHandle);
-        if (!varop) {
-            vpi_release_handle(resultHandle);
-            return nullptr;
-        }
-        VerilatedVpioVar* const partsel = varop->withPartSelect(bitRange.hi, bitRange.lo);
-        if (!partsel) {
-            vpi_release_handle(resultHandle);
-            return nullptr;
-        }
-        vpi_release_handle(resultHandle);
-        resultHandle = partsel->castVpiHandle();
-    }
-
-    return resultHandle;
+    VerilatedVpiNameEntry entry;
+    entry.scopep = scopep;
+    entry.varp = varp;
+    entry.fullnameOverride = std::move(fullnameOverride);
+    if (hasIndices) entry.indices = indices;
+    entry.bitRange = bitRange;
+    return _vl_vpi_handle_by_name_entry(
+        VerilatedVpiNameCache::insert(scopeAndName, std::move(entry)));
 }
 
 vpiHandle vpi_handle_by_index(vpiHandle object, PLI_INT32 indx) {
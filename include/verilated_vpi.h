@@ -69,4 +69,58 @@ public:
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
 
+//======================================================================
+/// Group of VPI variable handles whose values are read or written together.
+///
+/// Each handle is resolved once when added, after which getValues() and
+/// putValues() move every value between the model and a caller-provided
+/// buffer without per-signal VPI calls.  In the buffer each value is held
+/// as its Verilator C type (CData, SData, IData, QData, double, or the
+/// EData words of a VlWide), at offset(index), aligned for that type.
+///
+/// Handles may be released after add(). A batch is only valid while the
+/// model it refers to exists.
+
+class VerilatedVpiBatch final {
+    struct Entry final {
+        uint8_t* datap;  // Model storage of value
+        size_t offset;  // Byte offset of value in buffer
+        uint32_t size;  // Bytes of storage
+        uint32_t bits;  // Bits of value
+        VerilatedVarType vltype;  // Storage type
+        bool writable;  // Can be written by putValues
+    };
+    struct Run final {  // Contiguous storage copied to contiguous buffer by getValues
+        const uint8_t* datap;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<Entry> m_entries;  // In order of add()
+    std::vector<Run> m_runs;  // Coalesced entries for getValues
+    size_t m_bufferSize = 0;  // Bytes of buffer needed
+    size_t m_readOnly = 0;  // Number of entries that putValues cannot write
+
+public:
+    VerilatedVpiBatch() = default;
+    ~VerilatedVpiBatch() = default;
+    VL_UNCOPYABLE(VerilatedVpiBatch);
+
+    /// Add a variable handle to the batch. Returns false and sets a VPI
+    /// error if the handle is not a whole packed, real, or unpacked array
+    /// element variable.
+    bool add(vpiHandle handle) VL_MT_UNSAFE_ONE;
+    /// Number of handles in the batch
+    size_t size() const { return m_entries.size(); }
+    /// Bytes of buffer required by getValues/putValues
+    size_t bufferSize() const { return m_bufferSize; }
+    /// Byte offset in buffer of the value of the index'th handle added
+    size_t offset(size_t index) const { return m_entries[index].offset; }
+    /// Read the values of all handles into bufferp
+    void getValues(void* bufferp) const VL_MT_UNSAFE_ONE;
+    /// Write the values of all handles from bufferp, as vpi_put_value with
+    /// vpiNoDelay would.  Returns false and sets a VPI error, writing
+    /// nothing, if any handle is read-only or forceable.
+    bool putValues(const void* bufferp) VL_MT_UNSAFE_ONE;
+};
+
 #endif  // Guard
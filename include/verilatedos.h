@@ -382,6 +382,9 @@ extern "C" void __gcov_reset();
 #include <cinttypes>
 #include <cmath>
 #include <ctime>
+#if defined(__cplusplus) && __cplusplus >= 202002L
+# include <bit>  // std::countr_zero
+#endif
 
 #ifndef VL_NO_LEGACY
 using vluint8_t = uint8_t;  ///< 8-bit unsigned type (backward compatibility)
@@ -476,6 +479,7 @@ using ssize_t = uint32_t;  ///< signed size_t; returned from read()
 #define VL_EDATASIZE 32  ///< Bits in an EData (VlWide entry)
 #define VL_EDATASIZE_LOG2 5  ///< log2(VL_EDATASIZE)
 #define VL_CACHE_LINE_BYTES 64  ///< Bytes in a cache line (for alignment)
+#define VL_PAGE_BYTES 4096  ///< Bytes in a memory page (for NUMA placement)
 
 #ifndef VL_NO_LEGACY
 # define VL_WORDSIZE VL_IDATASIZE  // Legacy define
@@ -541,6 +545,22 @@ using ssize_t = uint32_t;  ///< signed size_t; returned from read()
 #define VL_BITISSET_E(data, bit) ((data) & (VL_EUL(1) << VL_BITBIT_E(bit)))
 #define VL_BITISSET_W(data, bit) ((data)[VL_BITWORD_E(bit)] & (VL_EUL(1) << VL_BITBIT_E(bit)))
 
+// Return bit number of the lowest set bit of a non-zero quad
+#if defined(__cplusplus) && __cplusplus >= 202002L
+# define VL_CTZ_Q(data) std::countr_zero(static_cast<uint64_t>(data))
+#elif defined(__GNUC__) || defined(__clang__)
+# define VL_CTZ_Q(data) __builtin_ctzll(data)
+#else
+inline int VL_CTZ_Q(uint64_t data) VL_PURE {
+    // Count the ones below the lowest set bit
+    uint64_t bits = (data & (~data + 1)) - 1;
+    bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+    bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<int>((bits * 0x0101010101010101ULL) >> 56);
+}
+#endif
+
 //=========================================================================
 // Floating point
 // #defines, to avoid requiring math.h on all compile runs
@@ -660,6 +680,7 @@ inline double VL_ROUND(double n) {
 //=========================================================================
 // Time and performance
 
+#include <atomic>
 #include <string>
 
 namespace VlOs {
@@ -684,6 +705,12 @@ extern unsigned getProcessDefaultParallelism() VL_MT_SAFE;
 /// Return memory usage in bytes, or 0 if unknown
 extern void memUsageBytes(uint64_t& peakr, uint64_t& currentr) VL_MT_SAFE;
 
+/// Block the calling thread while 'word' holds 'expected', or until woken by
+/// futexWake. May return spuriously, so the caller must recheck its condition.
+extern void futexWait(std::atomic<uint32_t>& word, uint32_t expected) VL_MT_SAFE;
+/// Wake all threads blocked in futexWait on 'word'
+extern void futexWake(std::atomic<uint32_t>& word) VL_MT_SAFE;
+
 // Internal: Record CPU time, starting point on construction, and current delta from that
 class DeltaCpuTime final {
     double m_start{};  // Time constructed at
@@ -36,7 +36,10 @@
 #endif
 
 #ifdef __linux
+# include <linux/futex.h>  // For FUTEX_WAIT_PRIVATE
 # include <sched.h>  // For sched_getcpu()
+# include <sys/syscall.h>  // For SYS_futex
+# include <unistd.h>  // For syscall()
 #endif
 #if defined(__APPLE__) && !defined(__arm64__) && !defined(__POWERPC__)
 # include <cpuid.h>  // For __cpuid_count()
@@ -193,6 +196,32 @@ void memUsageBytes(uint64_t& peakr, uint64_t& currentr) VL_MT_SAFE {
 #endif
 }
 
+//=========================================================================
+// VlOs::futexWait/futexWake implementation
+
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected) VL_MT_SAFE {
+#ifdef __linux
+    // std::atomic<uint32_t> is a plain aligned 32-bit word, as the futex requires
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr,
+            nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    word.wait(expected, std::memory_order_relaxed);
+#else
+    if (word.load(std::memory_order_relaxed) == expected) std::this_thread::yield();
+#endif
+}
+
+void futexWake(std::atomic<uint32_t>& word) VL_MT_SAFE {
+#ifdef __linux
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr,
+            nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    word.notify_all();
+#else
+    (void)word;  // futexWait just yields
+#endif
+}
+
 //=========================================================================
 // VlOs::getenvStr implementation
 
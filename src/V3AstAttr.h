@@ -912,8 +912,10 @@ public:
         SCHED_AWAITING_ZERO_DELAY,
         SCHED_READY,
         SCHED_COMMIT,
+        SCHED_COMMIT_SORTED,
         SCHED_MOVE_TO_RESUME_QUEUE,
         SCHED_DELAY,
+        SCHED_DELAY_ISOLATED,
         SCHED_DO_POST_UPDATES,
         SCHED_ENQUEUE,
         SCHED_EVALUATE,
@@ -1066,8 +1068,10 @@ inline std::ostream& operator<<(std::ostream& os, const VCMethod& rhs) {
            {SCHED_AWAITING_ZERO_DELAY, "awaitingZeroDelay", true}, \
            {SCHED_READY, "ready", false}, \
            {SCHED_COMMIT, "commit", false}, \
+           {SCHED_COMMIT_SORTED, "commitSorted", false}, \
            {SCHED_MOVE_TO_RESUME_QUEUE, "moveToResumeQueue", false}, \
            {SCHED_DELAY, "delay", false}, \
+           {SCHED_DELAY_ISOLATED, "delayIsolated", false}, \
            {SCHED_DO_POST_UPDATES, "doPostUpdates", false}, \
            {SCHED_ENQUEUE, "enqueue", false}, \
            {SCHED_EVALUATE, "evaluate", false}, \
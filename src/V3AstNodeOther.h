@@ -2142,6 +2142,7 @@ class AstVar final : public AstNode {
     VLifetime m_lifetime;  // Lifetime
     VRandAttr m_rand;  // Randomizability of this variable (rand, randc, etc)
     int m_pinNum = 0;  // For JSON, if non-zero the connection pin number
+    int m_mtaskWorker = -1;  // Worker thread using the NUMA placement group starting here
     bool m_ansi : 1;  // Params or pins declared in the module header, rather than the body
     bool m_declTyped : 1;  // Declared as type (for dedup check)
     bool m_tristate : 1;  // Inout or triwire or trireg
@@ -2205,6 +2206,7 @@ class AstVar final : public AstNode {
     bool m_isStdRandomizeArg : 1;  // Argument variable created for std::randomize (__Varg*)
     bool m_processQueue : 1;  // Process queue variable
     bool m_mtaskCacheLineAlign : 1;  // Start MTask affinity group on a cache line
+    bool m_mtaskPageAlign : 1;  // Start NUMA placement group on a page
     void init() {
         m_ansi = false;
         m_declTyped = false;
@@ -2269,6 +2271,7 @@ class AstVar final : public AstNode {
         m_isStdRandomizeArg = false;
         m_processQueue = false;
         m_mtaskCacheLineAlign = false;
+        m_mtaskPageAlign = false;
     }
 
 public:
@@ -2516,6 +2519,10 @@ public:
     bool isUsedLoopIdx() const { return m_usedLoopIdx; }
     bool mtaskCacheLineAlign() const { return m_mtaskCacheLineAlign; }
     void mtaskCacheLineAlign(bool flag) { m_mtaskCacheLineAlign = flag; }
+    bool mtaskPageAlign() const { return m_mtaskPageAlign; }
+    void mtaskPageAlign(bool flag) { m_mtaskPageAlign = flag; }
+    int mtaskWorker() const { return m_mtaskWorker; }
+    void mtaskWorker(int index) { m_mtaskWorker = index; }
     bool isSc() const VL_MT_SAFE { return m_sc; }
     bool isScQuad() const;
     bool isScBv() const VL_MT_STABLE;
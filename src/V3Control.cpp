@@ -24,6 +24,7 @@
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -792,16 +793,61 @@ public:
 };
 
 class V3ControlResolver final {
-    enum ProfileDataMode : uint8_t { NONE = 0, MTASK = 1, HIER_DPI = 2 };
+    enum ProfileDataMode : uint8_t { NONE = 0, MTASK = 1, HIER_DPI = 2, LOGIC = 4 };
+    // Profile costs by model, then by key
+    using ProfileCosts = std::unordered_map<string, std::unordered_map<string, uint64_t>>;
+    struct ProfileRun final {
+        ProfileCosts m_mtasks;  // profile_data -mtask records
+        ProfileCosts m_logic;  // profile_data -logic records
+    };
+    // Cost each run is scaled to when normalizing runs for --prof-pgo-auto
+    static constexpr double PROFILE_RUN_COST = 1e9;
+
     V3ControlModuleResolver m_modules;  // Access to module names (with wildcards)
     V3ControlFileResolver m_files;  // Access to file names (with wildcards)
     V3ControlScopeTraceResolver m_scopeTraces;  // Regexp to trace enables
-    std::unordered_map<string, std::unordered_map<string, uint64_t>>
-        m_profileData;  // Access to profile_data records
+    std::map<string, ProfileRun> m_profileRuns;  // Profile data of each run, by filename
+    std::unordered_map<string, uint64_t> m_profileHierDpi;  // profile_data -hier-dpi records
+    ProfileCosts m_profileData;  // Access to merged profile_data -mtask records
+    ProfileCosts m_profileLogic;  // Access to merged profile_data -logic records
+    bool m_profileMerged = true;  // m_profileData/m_profileLogic are up to date
+    // Keys of profile_data -logic records that matched logic in the design, by model
+    std::unordered_map<string, std::unordered_set<string>> m_profileLogicUsed;
     uint8_t m_mode = NONE;
     std::unordered_map<string, V3ControlResolverHierWorkerEntry> m_hierWorkers;
     FileLine* m_profileFileLine = nullptr;
 
+    // Merge the runs in m_profileRuns into m_profileData/m_profileLogic
+    void mergeProfileRuns() {
+        if (m_profileMerged) return;
+        m_profileMerged = true;
+        // With --prof-pgo-auto, each run is normalized to the same total cost, so every
+        // run (test) has equal weight, otherwise a long-running test would dominate.
+        const bool normalize = !v3Global.opt.profPgoAuto().empty() && m_profileRuns.size() > 1;
+        m_profileData.clear();
+        m_profileLogic.clear();
+        for (const auto& runIt : m_profileRuns) {
+            mergeProfileCosts(m_profileData, runIt.second.m_mtasks, normalize);
+            mergeProfileCosts(m_profileLogic, runIt.second.m_logic, normalize);
+        }
+    }
+    static void mergeProfileCosts(ProfileCosts& merged, const ProfileCosts& run, bool normalize) {
+        for (const auto& modelIt : run) {
+            uint64_t total = 0;
+            for (const auto& it : modelIt.second) total += it.second;
+            std::unordered_map<string, uint64_t>& mergedModel = merged[modelIt.first];
+            for (const auto& it : modelIt.second) {
+                uint64_t cost = it.second;
+                if (normalize) {
+                    cost = static_cast<uint64_t>(static_cast<double>(cost) * PROFILE_RUN_COST
+                                                 / static_cast<double>(total));
+                    if (cost == 0) cost = 1;  // Cost 0 means no data
+                }
+                mergedModel[it.first] += cost;
+            }
+        }
+    }
+
     V3ControlResolver() = default;
     ~V3ControlResolver() = default;
 
@@ -815,7 +861,6 @@ public:
     V3ControlScopeTraceResolver& scopeTraces() { return m_scopeTraces; }
 
     void addProfileData(FileLine* fl, const string& hierDpi, uint64_t cost) {
-        // Empty key for hierarchical DPI wrapper costs.
         addProfileData(fl, hierDpi, "", cost, HIER_DPI);
     }
     void addProfileData(FileLine* fl, const string& model, const string& key, uint64_t cost,
@@ -823,16 +868,25 @@ public:
         if (!m_profileFileLine) m_profileFileLine = fl;
         if (cost == 0) cost = 1;  // Cost 0 means delete (or no data)
         if (mode == MTASK) {
-            m_profileData[model][key] += cost;
+            m_profileRuns[fl->filename()].m_mtasks[model][key] += cost;
+            m_profileMerged = false;
+        } else if (mode == LOGIC) {
+            m_profileRuns[fl->filename()].m_logic[model][key] += cost;
+            m_profileMerged = false;
         } else if (mode == HIER_DPI) {
-            m_profileData[model][key] = std::max(m_profileData[model][key], cost);
+            m_profileHierDpi[model] = std::max(m_profileHierDpi[model], cost);
         }
         m_mode |= mode;
     }
+    void addProfileLogicData(FileLine* fl, const string& model, const string& key,
+                             uint64_t cost) {
+        addProfileData(fl, model, key, cost, LOGIC);
+    }
     bool containsMTaskProfileData() const { return m_mode & MTASK; }
+    bool containsLogicProfileData() const { return m_mode & LOGIC; }
     uint64_t getProfileData(const string& hierDpi) const {
-        // Empty key for hierarchical DPI wrapper costs.
-        return getProfileData(hierDpi, "");
+        const auto it = m_profileHierDpi.find(hierDpi);
+        return it == m_profileHierDpi.cend() ? 0 : it->second;
     }
     void addHierWorkers(FileLine* flp, const string& model, int workers) {
         m_hierWorkers.emplace(std::piecewise_construct, std::forward_as_tuple(model),
@@ -847,13 +901,33 @@ public:
         const auto mit = m_hierWorkers.find(model);
         return mit != m_hierWorkers.cend() ? mit->second.flp() : v3Global.rootp()->fileline();
     }
-    uint64_t getProfileData(const string& model, const string& key) const {
+    uint64_t getProfileData(const string& model, const string& key) {
+        mergeProfileRuns();
         const auto mit = m_profileData.find(model);
         if (mit == m_profileData.cend()) return 0;
         const auto it = mit->second.find(key);
         if (it == mit->second.cend()) return 0;
         return it->second;
     }
+    uint64_t getProfileLogicData(const string& model, const string& key) {
+        mergeProfileRuns();
+        const auto mit = m_profileLogic.find(model);
+        if (mit == m_profileLogic.cend()) return 0;
+        const auto it = mit->second.find(key);
+        if (it == mit->second.cend()) return 0;
+        m_profileLogicUsed[model].emplace(key);
+        return it->second;
+    }
+    size_t getProfileLogicCount(const string& model) {
+        mergeProfileRuns();
+        const auto mit = m_profileLogic.find(model);
+        return mit == m_profileLogic.cend() ? 0 : mit->second.size();
+    }
+    size_t getProfileLogicUnused(const string& model) {
+        const auto uit = m_profileLogicUsed.find(model);
+        return getProfileLogicCount(model)
+               - (uit == m_profileLogicUsed.cend() ? 0 : uit->second.size());
+    }
     FileLine* getProfileDataFileLine() const { return m_profileFileLine; }  // Maybe null
     static uint64_t getCurrentHierBlockCost() {
         if (uint64_t cost = V3Control::getProfileData(v3Global.opt.prefix())) {
@@ -945,6 +1019,11 @@ void V3Control::addProfileData(FileLine* fl, const string& model, const string&
     V3ControlResolver::s().addProfileData(fl, model, key, cost);
 }
 
+void V3Control::addProfileLogicData(FileLine* fl, const string& model, const string& key,
+                                    uint64_t cost) {
+    V3ControlResolver::s().addProfileLogicData(fl, model, key, cost);
+}
+
 void V3Control::addScopeTraceOn(bool on, const string& scope, int levels) {
     V3ControlResolver::s().scopeTraces().addScopeTraceOn(on, scope, levels);
 }
@@ -1100,6 +1179,15 @@ uint64_t V3Control::getProfileData(const string& hierDpi) {
 uint64_t V3Control::getProfileData(const string& model, const string& key) {
     return V3ControlResolver::s().getProfileData(model, key);
 }
+uint64_t V3Control::getProfileLogicData(const string& model, const string& key) {
+    return V3ControlResolver::s().getProfileLogicData(model, key);
+}
+size_t V3Control::getProfileLogicCount(const string& model) {
+    return V3ControlResolver::s().getProfileLogicCount(model);
+}
+size_t V3Control::getProfileLogicUnused(const string& model) {
+    return V3ControlResolver::s().getProfileLogicUnused(model);
+}
 FileLine* V3Control::getProfileDataFileLine() {
     return V3ControlResolver::s().getProfileDataFileLine();
 }
@@ -1112,6 +1200,9 @@ void V3Control::contentsPushText(const string& text) { WildcardContents::pushTex
 bool V3Control::containsMTaskProfileData() {
     return V3ControlResolver::s().containsMTaskProfileData();
 }
+bool V3Control::containsLogicProfileData() {
+    return V3ControlResolver::s().containsLogicProfileData();
+}
 uint64_t V3Control::getCurrentHierBlockCost() {
     return V3ControlResolver::s().getCurrentHierBlockCost();
 }
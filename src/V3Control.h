@@ -60,6 +60,8 @@ public:
     static void addProfileData(FileLine* fl, const string& hierDpi, uint64_t cost);
     static void addProfileData(FileLine* fl, const string& model, const string& key,
                                uint64_t cost);
+    static void addProfileLogicData(FileLine* fl, const string& model, const string& key,
+                                    uint64_t cost);
     static void addScopeTraceOn(bool on, const string& scope, int levels);
     static void addVarAttr(FileLine* fl, const string& module, const string& ftask,
                            VarSpecKind kind, const string& pattern, VAttrType type,
@@ -79,12 +81,17 @@ public:
     static const FsmRegisterWrapper* getFsmRegisterWrapper(const string& module);
     static uint64_t getProfileData(const string& hierDpi);
     static uint64_t getProfileData(const string& model, const string& key);
+    static uint64_t getProfileLogicData(const string& model, const string& key);
+    // Number of profile_data -logic records for model, and of those no logic matched
+    static size_t getProfileLogicCount(const string& model);
+    static size_t getProfileLogicUnused(const string& model);
     static FileLine* getProfileDataFileLine();
     static bool getScopeTraceOn(const string& scope);
 
     static void contentsPushText(const string& text);
 
     static bool containsMTaskProfileData();
+    static bool containsLogicProfileData();
     static uint64_t getCurrentHierBlockCost();
 
     static bool waive(const FileLine* filelinep, V3ErrorCode code, const string& message);
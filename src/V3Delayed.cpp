@@ -154,6 +154,7 @@ class DelayedVisitor final : public VNVisitor {
         bool m_partial = false;  // Used on LHS of NBA under a Sel
         bool m_inLoop = false;  // Used on LHS of NBA in a loop
         bool m_inSuspOrFork = false;  // Used on LHS of NBA in suspendable process or fork
+        uint32_t m_nNbas = 0;  // Number of NBAs with this variable on the LHS
         Scheme m_scheme = Scheme::Undecided;  // Conversion scheme to use for this variable
         uint32_t m_nTmp = 0;  // Temporary number for unique names
 
@@ -291,6 +292,7 @@ class DelayedVisitor final : public VNVisitor {
     VDouble0 m_nSchemeFlagUnique;  // Number of variables using Scheme::FlagUnique
     VDouble0 m_nSchemeValueQueuesWhole;  //  Number of variables using Scheme::ValueQueueWhole
     VDouble0 m_nSchemeValueQueuesPartial;  //  Number of variables using Scheme::ValueQueuePartial
+    VDouble0 m_nSortedCommits;  // Number of ValueQueue variables using sorted commit
     VDouble0 m_nSharedSetFlags;  // "Set" flags actually shared by Scheme::FlagShared variables
     VDouble0 m_nInitialNBA;  // Number of procedural blocks with initial NBA
 
@@ -863,9 +865,15 @@ class DelayedVisitor final : public VNVisitor {
         // Add 'Post' scheduled process for the commit
         AstAlwaysPost* const postp = new AstAlwaysPost{flp};
         activep->addStmtsp(postp);
-        // Add the commit
+        // Add the commit. If the same elements are likely updated multiple times per evaluation,
+        // that is, if there are multiple NBAs to the variable (e.g.: multiple write ports), or
+        // partial updates (e.g.: byte enables in a loop), use the sorted commit, which merges
+        // updates to the same element. Otherwise the program order commit is cheaper.
+        const bool sorted = N_Partial || vscpInfo.m_nNbas > 1;
+        if (sorted) ++m_nSortedCommits;
         AstCMethodHard* const callp = new AstCMethodHard{
-            flp, new AstVarRef{flp, queueVscp, VAccess::READWRITE}, VCMethod::SCHED_COMMIT};
+            flp, new AstVarRef{flp, queueVscp, VAccess::READWRITE},
+            sorted ? VCMethod::SCHED_COMMIT_SORTED : VCMethod::SCHED_COMMIT};
         callp->dtypeSetVoid();
         callp->addPinsp(new AstVarRef{flp, vscp, VAccess::WRITE});
         postp->addStmtsp(callp->makeStmt());
@@ -1292,6 +1300,7 @@ class DelayedVisitor final : public VNVisitor {
         vscpInfo.m_partial |= VN_IS(nodep->lhsp(), Sel);
         vscpInfo.m_inLoop |= m_inLoop;
         vscpInfo.m_inSuspOrFork |= m_inSuspendableOrFork;
+        ++vscpInfo.m_nNbas;
         // Sensitivity might be non-clocked, in a suspendable process, which are handled elsewhere
         if (m_activep->sentreep()->hasClocked()) {
             if (vscpInfo.m_fistActivep != m_activep) {
@@ -1356,6 +1365,7 @@ public:
         V3Stats::addStat("NBA, variables using ValueQueueWhole scheme", m_nSchemeValueQueuesWhole);
         V3Stats::addStat("NBA, variables using ValueQueuePartial scheme",
                          m_nSchemeValueQueuesPartial);
+        V3Stats::addStat("NBA, value queues using sorted commit", m_nSortedCommits);
         V3Stats::addStat("Optimizations, NBA flags shared", m_nSharedSetFlags);
         V3Stats::addStat("Procedures needing initial NBA trigger", m_nInitialNBA);
     }
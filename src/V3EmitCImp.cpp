@@ -599,6 +599,10 @@ class EmitCTrace final : public EmitCFunc {
     // NODE STATE/TYPES
     // None allowed to support threaded emitting
 
+    // CONSTANTS
+    // Minimum unpacked array size to compare with a single chg*Array call
+    static constexpr int TRACE_ARRAY_MIN_ELEMENTS = 8;
+
     // MEMBERS
     const bool m_slow;  // Making slow file
     const std::unique_ptr<EmitCTraceTypes> m_emitTypesp{m_slow ? new EmitCTraceTypes{} : nullptr};
@@ -738,10 +742,8 @@ class EmitCTrace final : public EmitCFunc {
         return -1;
     }
 
-    void emitTraceChangeOne(AstTraceInc* nodep, int arrayindex) {
-        // Note: Both VTraceType::CHANGE and VTraceType::FULL use the 'full' methods
-        const std::string func = nodep->traceType() == VTraceType::CHANGE ? "chg" : "full";
-        bool emitWidth = true;
+    string emitTraceSType(const AstTraceInc* nodep, bool& emitWidth) {
+        emitWidth = true;
         string stype;
         if (nodep->dtypep()->basicp()->isDouble()) {
             stype = "Double";
@@ -763,6 +765,46 @@ class EmitCTrace final : public EmitCFunc {
             stype = "Bit";
             emitWidth = false;
         }
+        return stype;
+    }
+
+    bool emitTraceChangeArray(AstTraceInc* nodep) {
+        // Compare a whole unpacked array against its contiguous old values in one call,
+        // letting the runtime test several elements per vector instruction. Only
+        // plain ascending arrays of integral elements qualify, as the element index
+        // must match the trace code order.
+        if (nodep->traceType() != VTraceType::CHANGE) return false;
+        const VNumRange& arrayRange = nodep->declp()->arrayRange();
+        if (!arrayRange.ranged() || !arrayRange.ascending()) return false;
+        if (arrayRange.elements() < TRACE_ARRAY_MIN_ELEMENTS) return false;
+        // The value is the variable, or the argument of a per-dtype trace function
+        const AstVarRef* const varrefp = VN_CAST(nodep->valuep(), VarRef);
+        if (varrefp ? varrefp->varp()->isSc() : !VN_IS(nodep->valuep(), CExpr)) return false;
+        const AstUnpackArrayDType* const adtypep
+            = VN_CAST(nodep->dtypep()->skipRefp(), UnpackArrayDType);
+        if (!adtypep || adtypep->elementsConst() != arrayRange.elements()) return false;
+        if (!VN_IS(adtypep->subDTypep()->skipRefp(), BasicDType)) return false;
+        bool emitWidth;
+        const string stype = emitTraceSType(nodep, emitWidth);
+        if (stype != "Bit" && stype != "CData" && stype != "SData" && stype != "IData"
+            && stype != "QData") {
+            return false;
+        }
+        putns(nodep, "bufp->chg" + stype + "Array(oldp+");
+        puts(cvtToStr(nodep->declp()->code() - nodep->baseCode()));
+        puts(",&");
+        emitTraceValue(nodep, -1);
+        puts("," + cvtToStr(arrayRange.elements()));
+        if (emitWidth) puts("," + cvtToStr(nodep->declp()->widthMin()));
+        puts(");\n");
+        return true;
+    }
+
+    void emitTraceChangeOne(AstTraceInc* nodep, int arrayindex) {
+        // Note: Both VTraceType::CHANGE and VTraceType::FULL use the 'full' methods
+        const std::string func = nodep->traceType() == VTraceType::CHANGE ? "chg" : "full";
+        bool emitWidth;
+        const string stype = emitTraceSType(nodep, emitWidth);
         putns(nodep, "bufp->" + func + stype);
 
         const uint32_t offset = (arrayindex < 0) ? 0 : (arrayindex * nodep->declp()->widthWords());
@@ -868,6 +910,7 @@ class EmitCTrace final : public EmitCFunc {
         }
     }
     void visit(AstTraceInc* nodep) override {
+        if (emitTraceChangeArray(nodep)) return;
         if (nodep->declp()->arrayRange().ranged()) {
             // It traces faster if we unroll the loop
             for (int i = 0; i < nodep->declp()->arrayRange().elements(); i++) {
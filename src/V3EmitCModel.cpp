@@ -521,6 +521,8 @@ class EmitCModel final : public EmitCFunc {
                             + "::traceConfig() const {\n");
             puts("return std::unique_ptr<VerilatedTraceConfig>{new VerilatedTraceConfig{");
             puts(v3Global.opt.useTraceParallel() ? "true" : "false");
+            puts(", ");
+            puts(v3Global.opt.traceOffload() ? "true" : "false");
             puts("}};\n");
             puts("};\n");
         }
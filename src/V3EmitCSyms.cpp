@@ -1183,11 +1183,38 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
                     const ExecMTask& mt = static_cast<const ExecMTask&>(vtx);
                     add("_vm_pgoProfiler.addCounter(" + std::to_string(mt.id()) + ", \""
                         + mt.hashName() + "\");");
+                    for (const ExecMTask::Logic& logic : mt.logics()) {
+                        add("_vm_pgoProfiler.addLogic(" + std::to_string(mt.id()) + ", \""
+                            + logic.first + "\", " + std::to_string(logic.second) + ");");
+                    }
                 }
             });
         }
     }
 
+    if (v3Global.opt.threadsNumaPlace() && v3Global.opt.mtasks()) {
+        // Variable ordering started a page aligned group of variables in the top module
+        // for each worker thread, each ended by the start of the next group
+        const std::string topName
+            = protect(v3Global.rootp()->topScopep()->scopep()->nameDotless());
+        std::vector<const AstVar*> startps;
+        for (const AstNode* nodep = v3Global.rootp()->topModulep()->stmtsp(); nodep;
+             nodep = nodep->nextp()) {
+            const AstVar* const varp = VN_CAST(nodep, Var);
+            if (varp && varp->mtaskPageAlign()) startps.push_back(varp);
+        }
+        if (!startps.empty()) add("// Place variables used by worker threads on their NUMA node");
+        for (size_t i = 0; i < startps.size(); ++i) {
+            if (startps[i]->mtaskWorker() < 0) continue;
+            const std::string endp
+                = i + 1 < startps.size()
+                      ? "&" + topName + "." + startps[i + 1]->nameProtect()
+                      : "reinterpret_cast<char*>(&" + topName + ") + sizeof(" + topName + ")";
+            add("__Vm_threadPoolp->numaPlace(" + std::to_string(startps[i]->mtaskWorker())
+                + ", &" + topName + "." + startps[i]->nameProtect() + ", " + endp + ");");
+        }
+    }
+
     add("// Configure time unit / time precision");
     if (!v3Global.rootp()->timeunit().isNone()) {
         const std::string unit = std::to_string(v3Global.rootp()->timeunit().powerOfTen());
@@ -298,6 +298,16 @@ public:
         return result;
     }
 
+    // Returns the number of dependencies of the given MTask within this schedule. Used with
+    // --threads-dynamic, where any dependency might execute on another thread.
+    uint32_t dependencies(const ExecMTask* mtaskp) const {
+        uint32_t result = 0;
+        for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+            if (contains(edge.fromp()->as<ExecMTask>())) ++result;
+        }
+        return result;
+    }
+
     uint32_t id() const { return m_id; }
     uint32_t scheduleOn(const ExecMTask* mtaskp, uint32_t bestThreadId) {
         mtasks.emplace(mtaskp);
@@ -814,11 +824,26 @@ void fillinCosts(V3Graph* execMTaskGraphp) {
         ExecMTask* const mtp = vtx.as<ExecMTask>();
         // This estimate is 64 bits, but the final mtask graph algorithm needs 32 bits
         const uint64_t costEstimate = V3InstrCount::count(mtp->funcp(), false);
-        const uint64_t costProfiled
-            = V3Control::getProfileData(v3Global.opt.prefix(), mtp->hashName());
+        uint64_t costProfiled = V3Control::getProfileData(v3Global.opt.prefix(), mtp->hashName());
         if (costProfiled) {
             UINFO(5, "Profile data for mtask " << mtp->id() << " " << mtp->hashName()
                                                << " cost override " << costProfiled);
+        } else if (!mtp->logics().empty()) {
+            // The mtask changed since profiling, e.g. due to contraction using the profile
+            // data, but if all of its logic was profiled, the sum of that is just as good.
+            for (const ExecMTask::Logic& logic : mtp->logics()) {
+                const uint64_t cost
+                    = V3Control::getProfileLogicData(v3Global.opt.prefix(), logic.first);
+                if (!cost) {
+                    costProfiled = 0;
+                    break;
+                }
+                costProfiled += cost;
+            }
+            if (costProfiled) {
+                UINFO(5, "Profile data for mtask " << mtp->id() << " logic cost override "
+                                                   << costProfiled);
+            }
         }
         costs[mtp->id()] = std::make_pair(costEstimate, costProfiled);
     }
@@ -898,6 +923,18 @@ void finalizeCosts(V3Graph* execMTaskGraphp) {
     }
 }
 
+void createMTaskStateVar(const string& name, uint32_t nDependencies) {
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    AstBasicDType* const s_mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
+    varp->isConst(true);
+    varp->valuep(new AstConst{fl, nDependencies});
+    varp->protect(false);  // Do not protect as we have references in text
+    modp->addStmtsp(varp);
+}
+
 void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId, AstCFunc* funcp,
                         const ExecMTask* mtaskp) {
     AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
@@ -913,18 +950,14 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
         // This mtask has dependencies executed on another thread, so it may block. Create the task
         // state variable and wait to be notified.
         const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
-        AstBasicDType* const s_mtaskStateDtypep
-            = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
-        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
-        varp->isConst(true);
-        varp->valuep(new AstConst{fl, nDependencies});
-        varp->protect(false);  // Do not protect as we have references in text
-        modp->addStmtsp(varp);
+        createMTaskStateVar(name, nDependencies);
         // For now, reference is still via text bashing
         if (v3Global.opt.profExec()) {
             addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
         }
-        addCStmt("vlSelf->" + name + +".waitUntilUpstreamDone(even_cycle);");
+        addCStmt("vlSelf->" + name
+                 + ".waitUntilUpstreamDone(even_cycle, "
+                   "vlSymsp->_vm_contextp__->threadsSpinLimit());");
         if (v3Global.opt.profExec()) {
             addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();");
         }
@@ -993,15 +1026,96 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
     }
 
     // Create the fake "final" mtask state variable
-    AstBasicDType* const s_mtaskStateDtypep
-        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
-    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP,
-                                    "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag,
-                                    s_mtaskStateDtypep};
-    varp->isConst(true);
-    varp->valuep(new AstConst(fl, funcps.size()));
-    varp->protect(false);  // Do not protect as we have references in text
-    modp->addStmtsp(varp);
+    createMTaskStateVar("__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag, funcps.size());
+
+    return funcps;
+}
+
+// With --threads-dynamic, create a function for each MTask that can be dispatched
+// by the runtime work-stealing scheduler. The function runs the MTask, then pushes
+// each successor that became ready onto the deque of the executing thread.
+std::unordered_map<const ExecMTask*, AstCFunc*>
+createDynamicMTaskFunctions(const ThreadSchedule& schedule, const string& tag) {
+    AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+
+    std::unordered_map<const ExecMTask*, AstCFunc*> funcps;
+    std::vector<const ExecMTask*> mtaskps;  // In deterministic order
+
+    // Create all functions first, as they reference each other
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        for (const ExecMTask* const mtaskp : thread) {
+            mtaskps.push_back(mtaskp);
+            const string name{"__Vmtask__" + tag + "__s" + cvtToStr(schedule.id()) + "__m"
+                              + cvtToStr(mtaskp->id())};
+            AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+            modp->addStmtsp(funcp);
+            funcps.emplace(mtaskp, funcp);
+            funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+            funcp->isLoose(true);
+            funcp->entryPoint(true);
+            funcp->argTypes("void* voidSelf, bool even_cycle");
+
+            // Create the task state variable, if it has any dependencies
+            if (const uint32_t nDependencies = schedule.dependencies(mtaskp)) {
+                createMTaskStateVar("__Vm_mtaskstate_" + cvtToStr(mtaskp->id()), nDependencies);
+            }
+        }
+    }
+
+    uint32_t nSinks = 0;
+    for (const ExecMTask* const mtaskp : mtaskps) {
+        AstCFunc* const funcp = funcps.at(mtaskp);
+        const auto addCStmt = [=](const string& stmt) -> void {  //
+            funcp->addStmtsp(new AstCStmt{fl, stmt});
+        };
+
+        // Setup vlSelf and vlSyms
+        addCStmt(EmitCUtil::voidSelfAssign(modp));
+        addCStmt(EmitCUtil::symClassAssign());
+
+        if (v3Global.opt.profPgo()) {
+            addCStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Call the MTask function
+        AstCCall* const callp = new AstCCall{fl, mtaskp->funcp()};
+        callp->selfPointer(VSelfPointerText{VSelfPointerText::VlSyms{}, scopep->nameDotless()});
+        callp->dtypeSetVoid();
+        funcp->addStmtsp(callp->makeStmt());
+
+        if (v3Global.opt.profPgo()) {
+            addCStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Signal each dependent MTask, and dispatch it if it became ready
+        bool isSink = true;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
+            if (!schedule.contains(nextp)) continue;
+            isSink = false;
+            AstCStmt* const cstmtp = new AstCStmt{fl};
+            funcp->addStmtsp(cstmtp);
+            cstmtp->add("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                        + ".signalUpstreamDone(even_cycle)) {\n");
+            cstmtp->add("VlThreadPool::dynamicPush(");
+            cstmtp->add(new AstAddrOfCFunc{fl, funcps.at(nextp)});
+            cstmtp->add(");\n}");
+        }
+
+        // Unblock the fake "final" mtask when all sinks are finished
+        if (isSink) {
+            ++nSinks;
+            addCStmt("vlSelf->__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag
+                     + ".signalUpstreamDone(even_cycle);");
+        }
+    }
+
+    // Create the fake "final" mtask state variable
+    createMTaskStateVar("__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag, nSinks);
 
     return funcps;
 }
@@ -1052,6 +1166,8 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
                  + "indexes.push_back(vlSymsp->__Vm_threadPoolp->assignWorkerIndex());\n"  //
                  + "}");
     }
+    // Add the tasks of the workers atomically, in case the workers are shared with other contexts
+    if (last > 0) addCStmt("vlSymsp->__Vm_threadPoolp->submitBegin();");
     uint32_t i = 0;
     for (AstCFunc* const funcp : funcps) {
         if (i != last) {
@@ -1066,7 +1182,9 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
             }
             cstmtp->add(")->addTask(");
             cstmtp->add(new AstAddrOfCFunc{fl, funcp});
-            cstmtp->add(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag + ");");
+            cstmtp->add(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag
+                        + ", vlSymsp->_vm_contextp__);");
+            if (i + 1 == last) addCStmt("vlSymsp->__Vm_threadPoolp->submitEnd();");
         } else {
             // The last will run on the main thread.
             AstCCall* const callp = new AstCCall{fl, funcp};
@@ -1082,7 +1200,8 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
         addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
     }
     addCStmt("vlSelf->__Vm_mtaskstate_final__" + std::to_string(scheduleId) + tag
-             + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag + ");");
+             + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag
+             + ", vlSymsp->_vm_contextp__->threadsSpinLimit());");
     if (v3Global.opt.profExec()) {
         addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();");
     }
@@ -1092,6 +1211,70 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     }
 }
 
+void addDynamicStartToExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& schedule,
+                                const std::unordered_map<const ExecMTask*, AstCFunc*>& funcps) {
+    // FileLine used for constructing nodes below
+    FileLine* const fl = v3Global.rootp()->fileline();
+    const string& tag = execGraphp->name();
+
+    // Add thread function invocations to execGraph
+    const auto addCStmt = [=](const string& stmt) -> void {  //
+        execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+
+    // As with static scheduling, the last non-empty thread is the calling thread,
+    // which uses deque 0, the others run on the thread pool.
+    std::vector<const std::vector<const ExecMTask*>*> threads;
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        if (!thread.empty()) threads.push_back(&thread);
+    }
+    const size_t last = threads.size() - 1;
+
+    addCStmt("vlSymsp->__Vm_threadPoolp->dynamicBegin(vlSelf, vlSymsp->__Vm_even_cycle__" + tag
+             + ", &vlSelf->__Vm_mtaskstate_final__" + std::to_string(schedule.id()) + tag + ", "
+             + std::to_string(funcps.size()) + ", " + std::to_string(last) + ");");
+
+    // Place MTasks without dependencies on the deque of their statically assigned thread
+    for (size_t i = 0; i < threads.size(); ++i) {
+        const size_t index = i == last ? 0 : i + 1;
+        for (const ExecMTask* const mtaskp : *threads[i]) {
+            if (schedule.dependencies(mtaskp)) continue;
+            AstCStmt* const cstmtp = new AstCStmt{fl};
+            execGraphp->addStmtsp(cstmtp);
+            cstmtp->add("vlSymsp->__Vm_threadPoolp->dynamicPlace(" + std::to_string(index)
+                        + ", ");
+            cstmtp->add(new AstAddrOfCFunc{fl, funcps.at(mtaskp)});
+            cstmtp->add(");");
+        }
+    }
+    V3Stats::addStatSum("Optimizations, Thread schedule total tasks", threads.size());
+
+    if (!v3Global.opt.profExec()) {
+        addCStmt("vlSymsp->__Vm_threadPoolp->dynamicRun();");
+        return;
+    }
+    // The threads run mtasks as they find them, so record the waits between
+    // them on each thread from the runtime, as the static schedule does per mtask
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    AstCFunc* const idleFuncp = new AstCFunc{
+        fl, "__Vmtask_idle__" + tag + "__s" + cvtToStr(schedule.id()), nullptr, "void"};
+    modp->addStmtsp(idleFuncp);
+    idleFuncp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+    idleFuncp->isLoose(true);
+    idleFuncp->entryPoint(true);
+    idleFuncp->argTypes("void* voidSelf, bool idle");
+    idleFuncp->addStmtsp(new AstCStmt{fl, EmitCUtil::voidSelfAssign(modp)});
+    idleFuncp->addStmtsp(new AstCStmt{fl, EmitCUtil::symClassAssign()});
+    idleFuncp->addStmtsp(new AstCStmt{
+        fl, "if (idle) {\nVL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n"
+            "} else {\nVL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();\n}"});
+    AstCStmt* const cstmtp = new AstCStmt{fl};
+    execGraphp->addStmtsp(cstmtp);
+    cstmtp->add("vlSymsp->__Vm_threadPoolp->dynamicRun(");
+    cstmtp->add(new AstAddrOfCFunc{fl, idleFuncp});
+    cstmtp->add(");");
+}
+
 void processMTaskBodies(AstExecGraph* const execGraphp) {
     for (V3GraphVertex* const vtxp : execGraphp->depGraphp()->vertices().unlinkable()) {
         ExecMTask* const mtaskp = vtxp->as<ExecMTask>();
@@ -1127,10 +1310,33 @@ void processMTaskBodies(AstExecGraph* const execGraphp) {
     }
 }
 
+// Record which thread pool worker runs each mtask, for V3VariableOrder. As in
+// addThreadStartToExecGraph, the last non-empty thread is the calling thread.
+void assignWorkers(const ThreadSchedule& schedule) {
+    std::vector<const std::vector<const ExecMTask*>*> threadps;
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        if (!thread.empty()) threadps.push_back(&thread);
+    }
+    for (size_t i = 0; i + 1 < threadps.size(); ++i) {
+        for (const ExecMTask* const mtaskp : *threadps[i]) {
+            const_cast<ExecMTask*>(mtaskp)->workerIndex(static_cast<int>(i));
+        }
+    }
+}
+
 void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& schedule) {
     // Nothing to be done if there are no MTasks in the graph at all.
     if (execGraphp->depGraphp()->empty()) return;
 
+    if (v3Global.opt.threadsDynamic()) {
+        // Create a function per MTask, to be dispatched at runtime
+        const std::unordered_map<const ExecMTask*, AstCFunc*> funcps
+            = createDynamicMTaskFunctions(schedule, execGraphp->name());
+        UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no MTasks?");
+        addDynamicStartToExecGraph(execGraphp, schedule, funcps);
+        return;
+    }
+
     // Create a function to be run by each thread.
     const std::vector<AstCFunc*>& funcps = createThreadFunctions(schedule, execGraphp->name());
     UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no threads?");
@@ -1139,8 +1345,23 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     addThreadStartToExecGraph(execGraphp, funcps, schedule.id());
 }
 
+void checkStaleProfileData() {
+    // All logic was looked up in the profile data during ordering, so anything not used by now
+    // was profiled on logic that no longer exists
+    const size_t unused = V3Control::getProfileLogicUnused(v3Global.opt.prefix());
+    if (!unused) return;
+    if (FileLine* const fl = V3Control::getProfileDataFileLine()) {
+        fl->v3warn(PROFOUTOFDATE, "Profile data for mtasks may be out of date. "
+                                      << unused << " of "
+                                      << V3Control::getProfileLogicCount(v3Global.opt.prefix())
+                                      << " profiled logic blocks no longer exist");
+    }
+}
+
 // Called by Verilator top stage
 void implement(AstNetlist* netlistp) {
+    checkStaleProfileData();
+
     // Gather all ExecGraphs
     std::vector<AstExecGraph*> execGraphps;
     netlistp->topModulep()->foreach([&](AstExecGraph* egp) { execGraphps.emplace_back(egp); });
@@ -1185,6 +1406,7 @@ void implement(AstNetlist* netlistp) {
         processMTaskBodies(execGraphp);
 
         for (const ThreadSchedule& schedule : packed) {
+            assignWorkers(schedule);
             // Replace the graph body with its multi-threaded implementation.
             implementExecGraph(execGraphp, schedule);
         }
@@ -23,6 +23,8 @@
 #include "V3Graph.h"
 
 #include <atomic>
+#include <utility>
+#include <vector>
 
 class AstNetlist;
 class AstCFunc;
@@ -35,6 +37,10 @@ class AstScope;
 
 class ExecMTask final : public V3GraphVertex {
     VL_RTTI_IMPL(ExecMTask, V3GraphVertex)
+public:
+    // Hashed name and estimated cost of one logic block within the mtask
+    using Logic = std::pair<std::string, uint32_t>;
+
 private:
     const uint32_t m_id;  // Unique ID of this ExecMTask.
     static std::atomic<uint32_t> s_nextId;  // Next ID to use
@@ -47,6 +53,10 @@ private:
     uint32_t m_cost = 0;
     uint64_t m_predictStart = 0;  // Predicted start time of task
     int m_threads = 1;  // Threads used by this mtask
+    int m_workerIndex = -1;  // Thread pool worker running this mtask, -1 if the main thread
+    // Logic blocks in this mtask, for profile-guided optimization. Hashed on the logic as
+    // ordered, so unlike m_hashName, they remain valid when mtasks are contracted differently.
+    std::vector<Logic> m_logics;
     VL_UNCOPYABLE(ExecMTask);
 
     static AstCFunc* createCFunc(AstExecGraph* execGraphp, AstScope* scopep, AstNodeStmt* stmtsp,
@@ -66,6 +76,10 @@ public:
     string hashName() const { return m_hashName; }
     void threads(int threads) { m_threads = threads; }
     int threads() const { return m_threads; }
+    void workerIndex(int index) { m_workerIndex = index; }
+    int workerIndex() const { return m_workerIndex; }
+    const std::vector<Logic>& logics() const { return m_logics; }
+    void logics(std::vector<Logic>&& logics) { m_logics = std::move(logics); }
     void dump(std::ostream& str) const;
 
     static uint32_t numUsedIds() VL_MT_SAFE { return s_nextId; }
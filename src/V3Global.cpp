@@ -24,6 +24,7 @@
 #include "V3HierBlock.h"
 #include "V3LibMap.h"
 #include "V3LinkCells.h"
+#include "V3Os.h"
 #include "V3Parse.h"
 #include "V3ParseImp.h"
 #include "V3PreShell.h"
@@ -97,6 +98,15 @@ void V3Global::readFiles() {
                              false, false, filelib.libname(),
                              "Cannot find file containing .vlt file: ");
         }
+        // Read profile data saved by earlier runs, each file being one run
+        if (!v3Global.opt.profPgoAuto().empty()) {
+            const string dir = v3Global.opt.profPgoAuto();
+            V3Os::createDir(dir);
+            for (const string& filename : V3Os::filenameList(dir, "*.vlt")) {
+                parser.parseFile(new FileLine{FileLine::commandLineFilename()}, filename, false,
+                                 false, "work", "Cannot find profile data file: ");
+            }
+        }
 
         // Parse the std package
         if (v3Global.opt.stdPackage()) {
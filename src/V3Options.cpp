@@ -996,6 +996,14 @@ void V3Options::notify() VL_MT_DISABLED {
         cmdfl->v3error(
             "--hierarchical must not be set with --hierarchical-child or --hierarchical-block");
     }
+    if (m_threadsDynamic && (m_hierarchical || m_hierChild || !m_hierBlocks.empty())) {
+        cmdfl->v3warn(E_UNSUPPORTED, "Unsupported: --threads-dynamic with --hierarchical");
+        m_threadsDynamic = false;
+    }
+    if (m_threadsNumaPlace && (m_hierarchical || m_hierChild || !m_hierBlocks.empty())) {
+        cmdfl->v3warn(E_UNSUPPORTED, "Unsupported: --threads-numa-place with --hierarchical");
+        m_threadsNumaPlace = false;
+    }
     if (m_hierChild) {
         if (m_hierBlocks.empty()) {
             cmdfl->v3error("--hierarchical-block must be set when --hierarchical-child is set");
@@ -1696,6 +1704,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
     DECL_OPTION("-prof-pgo", OnOff, &m_profPgo);
+    DECL_OPTION("-prof-pgo-auto", CbVal, [this](const char* valp) {
+        m_profPgoAuto = valp;
+        m_profPgo = true;
+    });
     DECL_OPTION("-profile-cfuncs", CbCall, [this]() {
         m_profC = m_profCFuncs = true;
     }).undocumented();  // Renamed
@@ -1808,10 +1820,12 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                         << fl->warnMore() << "... Suggest 'all', 'none', or 'pure'");
         }
     });
+    DECL_OPTION("-threads-dynamic", OnOff, &m_threadsDynamic);
     DECL_OPTION("-threads-max-mtasks", CbVal, [this, fl](const char* valp) {
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
     });
+    DECL_OPTION("-threads-numa-place", OnOff, &m_threadsNumaPlace);
     DECL_OPTION("-timescale", CbVal, [this, fl](const char* valp) {
         VTimescale unit;
         VTimescale prec;
@@ -1851,6 +1865,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     }).undocumented();
     DECL_OPTION("-trace-max-array", Set, &m_traceMaxArray);
     DECL_OPTION("-trace-max-width", Set, &m_traceMaxWidth);
+    DECL_OPTION("-trace-offload", OnOff, &m_traceOffload);
     DECL_OPTION("-trace-params", OnOff, &m_traceParams);
     DECL_OPTION("-trace-structs", OnOff, &m_traceStructs);
     DECL_OPTION("-trace-threads", CbVal, [fl](const char*) {
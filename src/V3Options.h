@@ -296,12 +296,15 @@ private:
     bool m_threadsCoarsen = true;   // main switch: --threads-coarsen
     bool m_threadsDpiPure = true;   // main switch: --threads-dpi all/pure
     bool m_threadsDpiUnpure = false;  // main switch: --threads-dpi all
+    bool m_threadsDynamic = false;  // main switch: --threads-dynamic
+    bool m_threadsNumaPlace = false;  // main switch: --threads-numa-place
     VOptionBool m_timing;           // main switch: --timing
     bool m_trace = false;           // main switch: --trace
     bool m_traceCoverage = false;   // main switch: --trace-coverage
     bool m_traceEnabledFst = false;  // main switch: --trace-fst
     bool m_traceEnabledSaif = false;  // main switch: --trace-saif
     bool m_traceEnabledVcd = false;  // main switch: --trace-vcd
+    bool m_traceOffload = false;    // main switch: --trace-offload
     bool m_traceParams = true;      // main switch: --trace-params
     bool m_traceStructs = false;    // main switch: --trace-structs
     bool m_noTraceTop = false;      // main switch: --no-trace-top
@@ -377,6 +380,7 @@ private:
     string      m_modPrefix;    // main switch: --mod-prefix
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
+    string      m_profPgoAuto;  // main switch: --prof-pgo-auto
     string      m_protectKey;   // main switch: --protect-key
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
@@ -572,12 +576,15 @@ public:
     bool threadsDpiPure() const { return m_threadsDpiPure; }
     bool threadsDpiUnpure() const { return m_threadsDpiUnpure; }
     bool threadsCoarsen() const { return m_threadsCoarsen; }
+    bool threadsDynamic() const { return m_threadsDynamic; }
+    bool threadsNumaPlace() const { return m_threadsNumaPlace; }
     VOptionBool timing() const { return m_timing; }
     bool trace() const { return m_trace; }
     bool traceCoverage() const { return m_traceCoverage; }
     bool traceEnabledFst() const { return m_traceEnabledFst; }
     bool traceEnabledSaif() const { return m_traceEnabledSaif; }
     bool traceEnabledVcd() const { return m_traceEnabledVcd; }
+    bool traceOffload() const { return m_traceOffload; }
     bool traceParams() const { return m_traceParams; }
     bool traceStructs() const { return m_traceStructs; }
     bool traceUnderscore() const { return m_traceUnderscore; }
@@ -661,7 +668,8 @@ public:
     int traceMaxArray() const { return m_traceMaxArray; }
     int traceMaxWidth() const { return m_traceMaxWidth; }
     bool useTraceParallel() const {
-        return trace() && traceEnabledVcd() && (threads() > 1 || hierChild() > 1);
+        return trace() && traceEnabledVcd() && !traceOffload()
+               && (threads() > 1 || hierChild() > 1);
     }
     int unrollCount() const { return m_unrollCount; }
     int unrollLimit() const { return m_unrollLimit; }
@@ -697,6 +705,7 @@ public:
     string modPrefix() const VL_MT_SAFE { return m_modPrefix; }
     string pipeFilter() const { return m_pipeFilter; }
     string prefix() const VL_MT_SAFE { return m_prefix; }
+    string profPgoAuto() const { return m_profPgoAuto; }
     // Not just called protectKey() to avoid bugs of not using protectKeyDefaulted()
     bool protectKeyProvided() const { return !m_protectKey.empty(); }
     string protectKeyDefaulted() VL_MT_SAFE;  // Set default key if not set by user
@@ -18,7 +18,9 @@
 
 #include "V3OrderMTaskGraph.h"
 
+#include "V3Control.h"
 #include "V3Global.h"
+#include "V3Hasher.h"
 #include "V3InstrCount.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -102,6 +104,38 @@ class OrderMTaskGraphBuilder final {
         return fanIn + fanOut == 4;
     }
 
+    // Replace the estimated costs with the costs measured by profile-guided optimization, so
+    // contraction balances the measured critical paths. The profiled costs are scaled to the
+    // same units as the estimates, which are still used for logic without profile data.
+    void applyProfileCosts() {
+        if (!V3Control::containsLogicProfileData()) return;
+        std::vector<std::pair<LogicMTask*, uint64_t>> profiled;
+        uint64_t sumCostEstimate = 0;  // For logic with estimate and profile
+        uint64_t sumCostProfiled = 0;  // For logic with estimate and profile
+        for (V3GraphVertex& vtx : m_mtaskGraph.vertices()) {
+            LogicMTask& mtask = static_cast<LogicMTask&>(vtx);
+            if (mtask.vertexList().empty()) continue;  // Entry/exit
+            const OrderLogicVertex* const olvp = mtask.vertexList().frontp()->logicp();
+            if (!olvp) continue;
+            const uint64_t cost = V3Control::getProfileLogicData(
+                v3Global.opt.prefix(), V3Hasher::uncachedHash(olvp->nodep()).toString());
+            if (!cost) continue;
+            sumCostEstimate += mtask.cost();
+            sumCostProfiled += cost;
+            profiled.emplace_back(&mtask, cost);
+        }
+        if (!sumCostProfiled) return;
+        const double profileToEst
+            = static_cast<double>(sumCostEstimate) / static_cast<double>(sumCostProfiled);
+        UINFO(5, "Profiled logic costs scaled by " << profileToEst << ", " << profiled.size()
+                                                   << " logic vertices with profile data");
+        for (const auto& pair : profiled) {
+            const uint64_t cost = static_cast<uint64_t>(static_cast<double>(pair.second)
+                                                        * profileToEst);
+            pair.first->cost(std::max<uint64_t>(cost, 1));
+        }
+    }
+
     // Add an edge to the graph, if there is not already an edge between the two vertices.
     void addEdge(LogicMTask& src, LogicMTask& dst) {
         UASSERT_OBJ(&src != &dst, &src, "Should not create self-edges");
@@ -123,6 +157,8 @@ class OrderMTaskGraphBuilder final {
             }
         }
 
+        applyProfileCosts();
+
         LogicMTask& entry = *mtaskGraph.entryp();
         LogicMTask& exit = *mtaskGraph.exitp();
 
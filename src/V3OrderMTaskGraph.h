@@ -166,6 +166,7 @@ public:
     const OrderMoveVertex::List& vertexList() const { return m_mVertices; }
     uint32_t id() const { return m_id; }
     uint64_t cost() const VL_MT_SAFE { return m_cost; }
+    void cost(uint64_t cost) { m_cost = cost; }
     uint64_t critPathCost(GraphWay way) const { return m_critPathCost[way]; }
     void setCritPathCost(GraphWay way, uint64_t cost) { m_critPathCost[way] = cost; }
 
@@ -25,12 +25,15 @@
 #include "V3ExecGraph.h"
 #include "V3Graph.h"
 #include "V3GraphStream.h"
+#include "V3Hasher.h"
+#include "V3InstrCount.h"
 #include "V3OrderCFuncEmitter.h"
 #include "V3OrderInternal.h"
 #include "V3OrderMTaskGraph.h"
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -180,6 +183,8 @@ AstNodeStmt* V3Order::createParallel(OrderMoveGraph& moveGraph, const std::strin
     std::unordered_map<const LogicMTask*, ExecMTask*> logicMTaskToExecMTask;
     OrderMoveGraphSerializer serializer{moveGraph};
     V3OrderCFuncEmitter emitter{tag, slow};
+    // Record the logic in each ExecMTask if needed for profile-guided optimization
+    const bool pgoLogic = v3Global.opt.profPgo() || V3Control::containsLogicProfileData();
     // Sort LogicMTask vertices by their serial IDs.
     struct MTaskVxIdLessThan final {
         bool operator()(const V3GraphVertex* lhsp, const V3GraphVertex* rhsp) const {
@@ -200,6 +205,7 @@ AstNodeStmt* V3Order::createParallel(OrderMoveGraph& moveGraph, const std::strin
 
         // Emit all logic within the MTask as they become ready
         OrderMoveDomScope* prevDomScopep = nullptr;
+        std::vector<ExecMTask::Logic> logics;
         while (OrderMoveVertex* const mVtxp = serializer.getNext()) {
             // We only really care about logic vertices
             if (OrderLogicVertex* const logicp = mVtxp->logicp()) {
@@ -207,6 +213,11 @@ AstNodeStmt* V3Order::createParallel(OrderMoveGraph& moveGraph, const std::strin
                 OrderMoveDomScope* const domScopep = &mVtxp->domScope();
                 if (domScopep != prevDomScopep) emitter.forceNewFunction();
                 prevDomScopep = domScopep;
+                if (pgoLogic) {
+                    AstNode* const nodep = logicp->nodep();
+                    logics.emplace_back(V3Hasher::uncachedHash(nodep).toString(),
+                                        V3InstrCount::count(nodep, false));
+                }
                 // Emit the logic under this vertex
                 emitter.emitLogic(logicp);
             }
@@ -216,6 +227,7 @@ AstNodeStmt* V3Order::createParallel(OrderMoveGraph& moveGraph, const std::strin
 
         // Create the ExecMTask
         ExecMTask* const execMTaskp = new ExecMTask{execGraphp, scopep, emitter.getStmts()};
+        execMTaskp->logics(std::move(logics));
         if (!v3Global.opt.hierBlocks().empty()) {
             execMTaskp->threads(DpiThreadsVisitor::apply(execMTaskp));
         }
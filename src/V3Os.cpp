@@ -37,6 +37,7 @@
 VL_DEFINE_DEBUG_FUNCTIONS;
 #endif
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>  // PATH_MAX (especially on FreeBSD)
 #include <cstdarg>
@@ -401,6 +402,31 @@ void V3Os::unlinkRegexp(const string& dir, const string& regexp) {
 #endif
 }
 
+std::vector<string> V3Os::filenameList(const string& dir, const string& wildcard) {
+    std::vector<string> names;
+#ifdef _MSC_VER
+    try {
+        for (const auto& dirEntry : std::filesystem::directory_iterator(dir.c_str())) {
+            if (VString::wildmatch(dirEntry.path().filename().string(), wildcard.c_str())) {
+                names.emplace_back(dir + "/" + dirEntry.path().filename().string());
+            }
+        }
+    } catch (std::filesystem::filesystem_error const& ex) {}
+#else
+    if (DIR* const dirp = opendir(dir.c_str())) {
+        while (struct dirent* const direntp = readdir(dirp)) {
+            if (VString::wildmatch(direntp->d_name, wildcard.c_str())) {
+                names.emplace_back(dir + "/" + std::string{direntp->d_name});
+            }
+        }
+        closedir(dirp);
+    }
+#endif
+    // Directory order is arbitrary, sort for reproducible results
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
 //######################################################################
 // METHODS (memory)
 
@@ -21,6 +21,7 @@
 #include "verilatedos.h"
 
 #include <array>
+#include <vector>
 
 // Limited V3 headers here - this is a base class for Vlc etc
 #include "V3Error.h"
@@ -71,6 +72,8 @@ public:
     static void filesystemFlush(const string& dirname);
     static void filesystemFlushBuildDir(const string& dirname);
     static void unlinkRegexp(const string& dir, const string& regexp);
+    ///< @return sorted names of files in dir matching wildcard, with dir prepended
+    static std::vector<string> filenameList(const string& dir, const string& wildcard);
 
     // METHODS (memory)
     static void releaseMemory();
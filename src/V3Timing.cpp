@@ -34,6 +34,14 @@
 //   type T_NEEDS_PROC. Using only nodes type T_NEEDS_PROC assures the flags are only propagated
 //   through paths leading to nodes that actually use VlProcess.
 //
+// TimingIsolationVisitor does not perform any AST transformations either. With --threads, it
+// finds initial processes whose only timing controls are delays, that do nothing with side
+// effects beyond writing plain variables, and whose variables are not written by any other such
+// process (nor read by another one if written here). Their delays become delayIsolated(), which
+// lets the delay scheduler resume them concurrently on the thread pool (see
+// verilated_timing.{h,cpp}). Other processes, and all non-timing logic, never run concurrently
+// with those resumptions, so they need not be considered.
+//
 // TimingControlVisitor is the one that actually performs transformations:
 // - for each intra-assignment timing control:
 //     - if it's a continuous assignment, transform it into an always
@@ -449,6 +457,109 @@ public:
     ~TimingSuspendableVisitor() override = default;
 };
 
+// ######################################################################
+//  Find processes that can be resumed concurrently
+
+class TimingIsolationVisitor final : public VNVisitorConst {
+    // TYPES
+    struct ProcAccess final {
+        AstInitial* m_procp;  // The candidate process
+        std::unordered_set<const AstVarScope*> m_reads;  // Non-local variables it reads
+        std::unordered_set<const AstVarScope*> m_writes;  // Non-local variables it writes
+    };
+
+    // STATE
+    std::vector<ProcAccess> m_candidates;  // Processes that only use delays and plain variables
+    std::unordered_map<const AstVarScope*, int> m_readers;  // Candidates reading each variable
+    std::unordered_map<const AstVarScope*, int> m_writers;  // Candidates writing each variable
+    std::unordered_set<const AstNode*>& m_isolatedr;  // Output: isolated processes
+
+    // METHODS
+    static bool isPlainDType(const AstNodeDType* dtypep) {
+        dtypep = dtypep->skipRefp();
+        if (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+            return isPlainDType(adtypep->subDTypep());
+        }
+        if (const AstBasicDType* const bdtypep = VN_CAST(dtypep, BasicDType)) {
+            return bdtypep->keyword().isIntNumeric() || bdtypep->isDouble();
+        }
+        return VN_IS(dtypep, PackArrayDType) || VN_IS(dtypep, EnumDType)
+               || (VN_IS(dtypep, NodeUOrStructDType) && dtypep->isIntegralOrPacked());
+    }
+    // Whether the node rules out running its process concurrently with others
+    static bool isUnsafe(AstNode* nodep) {
+        if (!nodep->isPure()) return true;
+        // Other timing controls and forks go through shared schedulers
+        if (VN_IS(nodep, EventControl) || VN_IS(nodep, Wait) || VN_IS(nodep, WaitFork)
+            || VN_IS(nodep, Fork) || VN_IS(nodep, Disable) || VN_IS(nodep, DisableFork)
+            || VN_IS(nodep, CAwait) || VN_IS(nodep, FireEvent)) {
+            return true;
+        }
+        // Calls and raw C++ could touch anything; NBAs share commit state
+        if (VN_IS(nodep, NodeCCall) || VN_IS(nodep, NodeFTaskRef) || VN_IS(nodep, CMethodHard)
+            || VN_IS(nodep, CExpr) || VN_IS(nodep, CStmt) || VN_IS(nodep, AssignDly)) {
+            return true;
+        }
+        if (const AstNodeAssign* const assignp = VN_CAST(nodep, NodeAssign)) {
+            if (assignp->timingControlp()) return true;
+        }
+        if (const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef)) {
+            if (!refp->varScopep() || refp->varp()->isForceable()) return true;
+            if (!isPlainDType(refp->varp()->dtypep())) return true;
+        }
+        return false;
+    }
+
+    // VISITORS
+    void visit(AstInitial* nodep) override {
+        if (hasFlags(nodep, T_HAS_PROC)) return;
+        if (!nodep->exists([](const AstDelay*) { return true; })) return;
+        if (nodep->exists([](AstNode* np) { return isUnsafe(np); })) return;
+        ProcAccess access{nodep, {}, {}};
+        nodep->foreach([&](const AstNodeVarRef* refp) {
+            // Locals are in the coroutine frame
+            if (refp->varp()->isFuncLocal()) return;
+            if (refp->access().isReadOrRW()) access.m_reads.insert(refp->varScopep());
+            if (refp->access().isWriteOrRW()) access.m_writes.insert(refp->varScopep());
+        });
+        for (const AstVarScope* const vscp : access.m_reads) ++m_readers[vscp];
+        for (const AstVarScope* const vscp : access.m_writes) ++m_writers[vscp];
+        m_candidates.emplace_back(std::move(access));
+    }
+    void visit(AstNodeModule* nodep) override {
+        // Class processes operate on shared objects
+        if (!VN_IS(nodep, Class)) iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeStmt*) override {}  // Accelerate
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    // CONSTRUCTORS
+    TimingIsolationVisitor(AstNetlist* nodep, std::unordered_set<const AstNode*>& isolated)
+        : m_isolatedr{isolated} {
+        iterateConst(nodep);
+        for (const ProcAccess& access : m_candidates) {
+            const auto othersWrite = [&](const AstVarScope* vscp) {
+                return m_writers[vscp] > (access.m_writes.count(vscp) ? 1 : 0);
+            };
+            const auto othersRead = [&](const AstVarScope* vscp) {
+                return m_readers[vscp] > (access.m_reads.count(vscp) ? 1 : 0);
+            };
+            bool isolated = true;
+            for (const AstVarScope* const vscp : access.m_writes) {
+                if (othersWrite(vscp) || othersRead(vscp)) isolated = false;
+            }
+            for (const AstVarScope* const vscp : access.m_reads) {
+                if (othersWrite(vscp)) isolated = false;
+            }
+            if (isolated) m_isolatedr.insert(access.m_procp);
+        }
+        V3Stats::addStat("Timing, isolated processes", m_isolatedr.size());
+    }
+    ~TimingIsolationVisitor() override = default;
+};
+
 // ######################################################################
 //  Transform nodes affected by timing
 
@@ -482,6 +593,7 @@ class TimingControlVisitor final : public VNVisitor {
     int m_forkCnt = 0;  // Number of forks inside a module
     bool m_underJumpBlock = false;  // True if we are inside of a jump-block
     bool m_underProcedure = false;  // True if we are under an always or initial
+    bool m_underIsolated = false;  // True if we are under a process in m_isolated
     bool m_underIfaceCFunc = false;  // True if we are under a CFunc owned by an interface scope
     bool m_hasStaticZeroDelay = false;  // True if we have a static #0 delay
     std::vector<FileLine*> m_unknownDelayFlps;  // Locations of AstDelay with non-constant value
@@ -508,6 +620,8 @@ class TimingControlVisitor final : public VNVisitor {
     AstSenTree* m_dynamicSensesp = nullptr;  // Domain to trigger if a dynamic trigger is set
 
     // Other
+    // Processes whose delays may be resumed concurrently, from TimingIsolationVisitor
+    const std::unordered_set<const AstNode*>& m_isolated;
     SenTreeFinder m_finder{m_netlistp};  // Sentree finder and uniquifier
     SenExprBuilder* m_senExprBuilderp = nullptr;  // Sens expression builder for current m_scope
 
@@ -906,6 +1020,8 @@ class TimingControlVisitor final : public VNVisitor {
         m_hasProcess = hasFlags(nodep, T_HAS_PROC);
         VL_RESTORER(m_underProcedure);
         m_underProcedure = true;
+        VL_RESTORER(m_underIsolated);
+        m_underIsolated = m_isolated.count(nodep);
         iterateChildren(nodep);
         if (hasFlags(nodep, T_SUSPENDEE)) nodep->setSuspendable();
         if (hasFlags(nodep, T_HAS_PROC)) nodep->setNeedProcess();
@@ -1065,7 +1181,8 @@ class TimingControlVisitor final : public VNVisitor {
         // Replace self with a 'co_await dlySched.delay(<valuep>)'
         AstCMethodHard* const delayMethodp = new AstCMethodHard{
             flp, new AstVarRef{flp, getCreateDelayScheduler(), VAccess::WRITE},
-            VCMethod::SCHED_DELAY, valuep};
+            m_underIsolated ? VCMethod::SCHED_DELAY_ISOLATED : VCMethod::SCHED_DELAY,
+            valuep};
         delayMethodp->dtypeSetVoid();
         addProcessInfo(delayMethodp);
         addDebugInfo(delayMethodp);
@@ -1470,8 +1587,9 @@ class TimingControlVisitor final : public VNVisitor {
 
 public:
     // CONSTRUCTORS
-    explicit TimingControlVisitor(AstNetlist* nodep)
-        : m_netlistp{nodep} {
+    TimingControlVisitor(AstNetlist* nodep, const std::unordered_set<const AstNode*>& isolated)
+        : m_netlistp{nodep}
+        , m_isolated{isolated} {
         iterate(nodep);
 
         // If there is no static #0 in the design, but an unknown delay was found,
@@ -1506,7 +1624,11 @@ void V3Timing::timingAll(AstNetlist* nodep) {
         const VNUser1InUse m_user1InUse;
         const VNUser2InUse m_user2InUse;
         { TimingSuspendableVisitor{nodep}; }
-        if (v3Global.usesTiming()) TimingControlVisitor{nodep};
+        if (v3Global.usesTiming()) {
+            std::unordered_set<const AstNode*> isolated;
+            if (v3Global.opt.threads() > 1) TimingIsolationVisitor{nodep, isolated};
+            TimingControlVisitor{nodep, isolated};
+        }
     }
     V3Global::dumpCheckGlobalTree("timing", 0, dumpTreeEitherLevel() >= 3);
 }
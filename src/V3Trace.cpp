@@ -50,6 +50,7 @@
 #include <map>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -615,6 +616,29 @@ class TraceVisitor final : public VNVisitor {
         return callp->makeStmt();
     }
 
+    // Whether the node is in a process resumed concurrently by the delay scheduler
+    static bool inIsolatedCoroutine(AstNode* nodep) {
+        const AstCFunc* funcp = nullptr;
+        for (AstNode* np = nodep; np && !funcp; np = np->backp()) funcp = VN_CAST(np, CFunc);
+        if (!funcp || !funcp->isCoroutine() || !funcp->stmtsp()) return false;
+        return funcp->stmtsp()->existsAndNext([](const AstCAwait* awaitp) {
+            const AstCMethodHard* const methodp = VN_CAST(awaitp->exprp(), CMethodHard);
+            return methodp && methodp->method() == VCMethod::SCHED_DELAY_ISOLATED;
+        });
+    }
+
+    // Add setters after the delay scheduler's resume(), on the eval thread
+    void addIsolatedSetters(AstNode* settersp) {
+        AstCMethodHard* resumep = nullptr;
+        v3Global.rootp()->foreach([&](AstCMethodHard* methodp) {
+            if (methodp->method() != VCMethod::SCHED_RESUME) return;
+            const AstBasicDType* const basicp = methodp->fromp()->dtypep()->basicp();
+            if (basicp && basicp->isDelayScheduler()) resumep = methodp;
+        });
+        UASSERT_OBJ(resumep, settersp, "Isolated delays without a delay scheduler resume");
+        VN_AS(resumep->backp(), StmtExpr)->addNextHere(settersp);
+    }
+
     void createActivityFlags() {
         // Assign final activity numbers
         m_activityNumber = assignactivityNumbers();
@@ -638,6 +662,10 @@ class TraceVisitor final : public VNVisitor {
         m_activityVscp = newvscp;
 
         // Insert activity setters
+        // Processes resumed concurrently on the thread pool (see V3Timing) must not
+        // write the shared activity flags, so theirs are set after the resumption
+        AstNode* isolatedSettersp = nullptr;
+        std::unordered_set<uint32_t> isolatedCodes;
         for (const V3GraphVertex& vtx : m_graph.vertices()) {
             if (const TraceActivityVertex* const vtxp = vtx.cast<const TraceActivityVertex>()) {
                 AstNode* setterp = nullptr;
@@ -650,7 +678,13 @@ class TraceVisitor final : public VNVisitor {
                 }
                 if (setterp) {
                     AstNode* const insertp = vtxp->insertp();
-                    if (AstStmtExpr* const stmtp = VN_CAST(insertp, StmtExpr)) {
+                    if (inIsolatedCoroutine(insertp)) {
+                        if (isolatedCodes.insert(vtxp->activityCode()).second) {
+                            isolatedSettersp = AstNode::addNext(isolatedSettersp, setterp);
+                        } else {
+                            VL_DO_DANGLING(setterp->deleteTree(), setterp);
+                        }
+                    } else if (AstStmtExpr* const stmtp = VN_CAST(insertp, StmtExpr)) {
                         stmtp->addNextHere(setterp);
                     } else if (AstCFunc* const funcp = VN_CAST(insertp, CFunc)) {
                         // If there are awaits, insert the setter after each await
@@ -666,6 +700,7 @@ class TraceVisitor final : public VNVisitor {
                 }
             }
         }
+        if (isolatedSettersp) addIsolatedSetters(isolatedSettersp);
     }
 
     AstCFunc* newCFunc(VTraceType traceType, AstCFunc* topFuncp, uint32_t funcNum,
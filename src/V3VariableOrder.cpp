@@ -98,11 +98,14 @@ class VariableOrder final {
     std::unordered_map<const AstVar*, VarAttributes> m_attributes;
 
     const MTaskAffinityMap& m_mTaskAffinity;
+    // Worker thread running each MTask, by MTask ID, if placing variables on NUMA nodes
+    const std::vector<int>& m_mTaskWorkers;
     std::vector<AstVar*>& m_varps;
 
     VariableOrder(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
-                  std::vector<AstVar*>& varps)
+                  const std::vector<int>& mTaskWorkers, std::vector<AstVar*>& varps)
         : m_mTaskAffinity{mTaskAffinity}
+        , m_mTaskWorkers{mTaskWorkers}
         , m_varps{varps} {
         orderModuleVars(modp);
     }
@@ -134,6 +137,19 @@ class VariableOrder final {
         return std::find(vec.begin(), vec.end(), true) == vec.end();
     }
 
+    // The worker thread running all MTasks in the affinity group, or -1 if none or many
+    int groupWorker(const MTaskIdVec& vec) const {
+        if (m_mTaskWorkers.empty()) return -1;
+        int worker = -1;
+        for (size_t id = 0; id < vec.size(); ++id) {
+            if (!vec[id]) continue;
+            const int mTaskWorker = m_mTaskWorkers[id];
+            if (mTaskWorker < 0 || (worker >= 0 && mTaskWorker != worker)) return -1;
+            worker = mTaskWorker;
+        }
+        return worker;
+    }
+
     // Sort by MTask-affinity first, then the same as simpleSortVars
     void mtaskSortVars(std::vector<AstVar*>& varps) {
         // Map from "MTask affinity" -> "variable list"
@@ -162,18 +178,51 @@ class VariableOrder final {
                   }
               };
 
+        // Start a NUMA placement group used by the given worker (or -1 for none) at the first
+        // variable from 'start' that is emitted as a non-static member, if any.
+        const auto pageAlign = [&varps](size_t start, int worker) {
+            for (size_t i = start; i < varps.size(); ++i) {
+                const AstVar* const varp = varps[i];
+                if (varp->isStatic()) continue;
+                if (!varp->isIO() && !varp->isSignal() && !varp->isClassMember()
+                    && !varp->isTemp() && !varp->isGenVar()) {
+                    continue;
+                }
+                varps[i]->mtaskPageAlign(true);
+                varps[i]->mtaskWorker(worker);
+                if (worker >= 0) V3Stats::addStatSum("VariableOrder, NUMA placement groups", 1);
+                return true;
+            }
+            return false;
+        };
+
         // Sort non-empty MTask affinity groups in the map's deterministic key order. This keeps
         // memory linear in the number of affinity groups, unlike the old complete
-        // pairwise-distance ordering.
-        size_t affinityGroups = 0;
+        // pairwise-distance ordering. If placing variables on NUMA nodes, then also
+        // stable sort by the worker using the group, so each worker's variables are together,
+        // with the groups used by no single worker last.
+        std::vector<std::pair<int, std::vector<AstVar*>*>> groups;
         for (auto& pair : m2v) {
             if (emptyAffinity(pair.first)) continue;
-            sortAndAppend(pair.second, true);
-            ++affinityGroups;
+            groups.emplace_back(groupWorker(pair.first), &pair.second);
+        }
+        std::stable_sort(groups.begin(), groups.end(), [](const auto& a, const auto& b) {
+            return static_cast<unsigned>(a.first) < static_cast<unsigned>(b.first);
+        });
+        int placedWorker = -1;  // Worker of the current NUMA placement group
+        for (const auto& group : groups) {
+            const size_t start = varps.size();
+            sortAndAppend(*group.second, true);
+            if (group.first != placedWorker && pageAlign(start, group.first)) {
+                placedWorker = group.first;
+            }
         }
 
         // Finally add the variables with no known MTask affinity
+        const size_t start = varps.size();
         sortAndAppend(m2v[emptyVec], false);
+        if (placedWorker != -1) pageAlign(start, -1);
+        const size_t affinityGroups = groups.size();
 
         V3Stats::addStatSum("VariableOrder, MTask affinity groups", affinityGroups);
         V3Stats::addStatSum("VariableOrder, no-affinity variables", m2v[emptyVec].size());
@@ -215,8 +264,11 @@ class VariableOrder final {
 
 public:
     static void processModule(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
+                              const std::vector<int>& mTaskWorkers,
                               std::vector<AstVar*>& varps) VL_MT_STABLE {
-        VariableOrder{modp, mTaskAffinity, varps};
+        // NUMA placement is only implemented for the top module
+        static const std::vector<int> s_noWorkers;
+        VariableOrder{modp, mTaskAffinity, modp->isTop() ? mTaskWorkers : s_noWorkers, varps};
     }
 };
 
@@ -227,12 +279,16 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     MTaskAffinityMap mTaskAffinity;
+    std::vector<int> mTaskWorkers;  // Worker thread running each MTask, by MTask ID
 
     // Gather MTask affinities
     if (v3Global.opt.mtasks()) {
+        if (v3Global.opt.threadsNumaPlace()) mTaskWorkers.resize(ExecMTask::numUsedIds(), -1);
         netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
             for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
-                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity);
+                const ExecMTask* const mTaskp = vtx.as<const ExecMTask>();
+                GatherMTaskAffinity::apply(mTaskp, mTaskAffinity);
+                if (!mTaskWorkers.empty()) mTaskWorkers[mTaskp->id()] = mTaskp->workerIndex();
             }
         });
     }
@@ -246,8 +302,8 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, &mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
+            threadScope.enqueue([modp, &mTaskAffinity, &mTaskWorkers, &varps]() {
+                VariableOrder::processModule(modp, mTaskAffinity, mTaskWorkers, varps);
             });
         }
     }
@@ -20,6 +20,8 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <algorithm>
+
 #ifndef V3ERROR_NO_GLOBAL_
 #define V3ERROR_NO_GLOBAL_
 #endif
@@ -38,6 +40,17 @@ class VlcBuckets final {
 
     static uint64_t covBit(uint64_t point) { return 1ULL << (point & 63); }
     uint64_t allocSize() const { return sizeof(uint64_t) * m_dataSize / 64; }
+    uint64_t words() const { return m_dataSize / 64; }
+    static uint64_t wordPopCount(uint64_t word) {
+#ifdef __GNUC__
+        return __builtin_popcountll(word);
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (word * 0x0101010101010101ULL) >> 56;
+#endif
+    }
     void allocate(uint64_t point) {
         const uint64_t oldsize = m_dataSize;
         if (m_dataSize < point) m_dataSize = (point + 64) & ~63ULL;  // Keep power of two
@@ -88,22 +101,21 @@ public:
     }
     uint64_t popCount() const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) ++pop;
-        }
+        for (uint64_t i = 0; i < words(); ++i) pop += wordPopCount(m_datap[i]);
         return pop;
     }
     uint64_t dataPopCount(const VlcBuckets& remaining) const {
+        // Hot function in --rank, so operate on whole words rather than on bits
+        const uint64_t nWords = std::min(words(), remaining.words());
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && remaining.hits(i)) ++pop;
+        for (uint64_t i = 0; i < nWords; ++i) {
+            pop += wordPopCount(m_datap[i] & remaining.m_datap[i]);
         }
         return pop;
     }
     void orData(const VlcBuckets& ordata) {
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && ordata.hits(i)) clearHits(i);
-        }
+        const uint64_t nWords = std::min(words(), ordata.words());
+        for (uint64_t i = 0; i < nWords; ++i) m_datap[i] &= ~ordata.m_datap[i];
     }
 
     void dump() const {
@@ -88,6 +88,13 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
     DECL_OPTION("-debugi", CbVal, [](int v) { V3Error::debugDefault(v); });
     DECL_OPTION("-filter-type", Set, &m_filterType);
     DECL_OPTION("-include-reset-arcs", OnOff, &m_includeResetArcs);
+    DECL_OPTION("-j", CbVal, [this](const char* valp) {
+        if (!std::isdigit(valp[0])) {
+            v3fatal("-j requires a non-negative integer, but '" << valp << "' was passed");
+        }
+        const int val = std::atoi(valp);
+        m_jobs = val ? val : VlOs::getProcessDefaultParallelism();
+    });
     DECL_OPTION("-levels", Set, &m_reportLevels);
     DECL_OPTION("-rank", OnOff, &m_rank);
     DECL_OPTION("-report", Set, &m_report);
@@ -154,7 +161,7 @@ int main(int argc, char** argv) {
 
     {
         const VlStringSet& readFiles = top.opt.readFiles();
-        for (const auto& filename : readFiles) top.readCoverage(filename);
+        top.readCoverages(readFiles);
     }
 
     if (debug() >= 9) {
@@ -40,6 +40,7 @@ class VlcOptions final {
     int m_annotateMin = 10;     // main switch: --annotate-min I<count>
     bool m_annotatePoints = false;  // main switch: --annotate-points
     bool m_includeResetArcs = false;  // main switch: --include-reset-arcs
+    unsigned m_jobs = 1;        // main switch: -j I<jobs>
     string m_filterType = "*";  // main switch: --filter-type
     VlStringSet m_readFiles;    // main switch: --read
     int m_reportLevels = -1;    // main switch: --levels, negative means all depths
@@ -74,6 +75,7 @@ public:
     bool countOk(uint64_t count) const { return count >= static_cast<uint64_t>(m_annotateMin); }
     bool annotatePoints() const { return m_annotatePoints; }
     bool includeResetArcs() const { return m_includeResetArcs; }
+    unsigned jobs() const { return m_jobs; }
     int reportLevels() const { return m_reportLevels; }
     bool reportSpecified() const { return !m_report.empty(); }
     bool reportSummary() const { return m_reportSummary; }
@@ -37,19 +37,19 @@
 
 class VlcPoint final {
     // MEMBERS
-    string m_name;  //< Name of the point
+    const string* m_namep;  //< Name of the point, owned by VlcPoints
     uint64_t m_pointNum;  //< Point number
     uint64_t m_testsCovering = 0;  //< Number tests with non-zero coverage of this point
     uint64_t m_count = 0;  //< Count of hits across all tests
 
 public:
     // CONSTRUCTORS
-    VlcPoint(const string& name, uint64_t pointNum)
-        : m_name{name}
+    VlcPoint(const string* namep, uint64_t pointNum)
+        : m_namep{namep}
         , m_pointNum{pointNum} {}
     ~VlcPoint() = default;
     // ACCESSORS
-    const string& name() const { return m_name; }
+    const string& name() const { return *m_namep; }
     uint64_t pointNum() const { return m_pointNum; }
     uint64_t testsCovering() const { return m_testsCovering; }
     void countInc(uint64_t inc) { m_count += inc; }
@@ -61,39 +61,39 @@ public:
         return m_count >= threshi;
     }
     // KEY ACCESSORS
-    string filename() const { return keyExtract(VL_CIK_FILENAME, m_name.c_str()); }
-    string comment() const { return keyExtract(VL_CIK_COMMENT, m_name.c_str()); }
-    string hier() const { return keyExtract(VL_CIK_HIER, m_name.c_str()); }
-    string page() const { return keyExtract("page", m_name.c_str()); }
-    string type() const { return typeExtract(m_name.c_str()); }
+    string filename() const { return keyExtract(VL_CIK_FILENAME, name().c_str()); }
+    string comment() const { return keyExtract(VL_CIK_COMMENT, name().c_str()); }
+    string hier() const { return keyExtract(VL_CIK_HIER, name().c_str()); }
+    string page() const { return keyExtract("page", name().c_str()); }
+    string type() const { return typeExtract(name().c_str()); }
     // Covergroup-specific key accessors (long keys, no short-key alias)
-    string bin() const { return keyExtract("bin", m_name.c_str()); }
-    string binType() const { return keyExtract("bin_type", m_name.c_str()); }
-    bool isCross() const { return !keyExtract("cross", m_name.c_str()).empty(); }
-    string crossBins() const { return keyExtract(VL_CIK_CROSS_BINS, m_name.c_str()); }
+    string bin() const { return keyExtract("bin", name().c_str()); }
+    string binType() const { return keyExtract("bin_type", name().c_str()); }
+    bool isCross() const { return !keyExtract("cross", name().c_str()).empty(); }
+    string crossBins() const { return keyExtract(VL_CIK_CROSS_BINS, name().c_str()); }
     string thresh() const {
         // string as maybe ""
-        return keyExtract(VL_CIK_THRESH, m_name.c_str());
+        return keyExtract(VL_CIK_THRESH, name().c_str());
     }
-    string linescov() const { return keyExtract(VL_CIK_LINESCOV, m_name.c_str()); }
+    string linescov() const { return keyExtract(VL_CIK_LINESCOV, name().c_str()); }
     bool isFsmState() const { return type() == "fsm_state"; }
     bool isFsmArc() const { return type() == "fsm_arc"; }
     // Arc-specific helpers are used after callers have already filtered to
     // FSM arc points, so they do not repeat the type check here.
-    string fsmVarName() const { return keyExtract(VL_CIK_FSM_VAR, m_name.c_str()); }
-    string fsmFromState() const { return keyExtract(VL_CIK_FSM_FROM, m_name.c_str()); }
-    string fsmToState() const { return keyExtract(VL_CIK_FSM_TO, m_name.c_str()); }
-    string fsmTag() const { return keyExtract(VL_CIK_FSM_TAG, m_name.c_str()); }
+    string fsmVarName() const { return keyExtract(VL_CIK_FSM_VAR, name().c_str()); }
+    string fsmFromState() const { return keyExtract(VL_CIK_FSM_FROM, name().c_str()); }
+    string fsmToState() const { return keyExtract(VL_CIK_FSM_TO, name().c_str()); }
+    string fsmTag() const { return keyExtract(VL_CIK_FSM_TAG, name().c_str()); }
     bool isFsmResetInclude() const { return fsmTag() == "reset_include"; }
     bool isFsmResetArc() const { return fsmTag() == "reset"; }
     bool isFsmDefaultArc() const { return fsmTag() == "default"; }
     bool fsmIsReset() const { return isFsmResetArc() || isFsmResetInclude(); }
     int lineno() const {
-        const string lineStr = keyExtract(VL_CIK_LINENO, m_name.c_str());
+        const string lineStr = keyExtract(VL_CIK_LINENO, name().c_str());
         return std::atoi(lineStr.c_str());
     }
     int column() const {
-        const string columnStr = keyExtract(VL_CIK_COLUMN, m_name.c_str());
+        const string columnStr = keyExtract(VL_CIK_COLUMN, name().c_str());
         return std::atoi(columnStr.c_str());
     }
     // METHODS
@@ -152,9 +152,26 @@ public:
 // VlcPoints - Container of all points
 
 class VlcPoints final {
+    // TYPES
+    // Reference to a name, hashed and compared by value.  Lets m_nameIndex
+    // share the strings owned by m_nameMap instead of keeping its own copies.
+    struct NameRef final {
+        const string* m_namep;
+    };
+    struct NameRefHash final {
+        size_t operator()(const NameRef& ref) const { return std::hash<string>{}(*ref.m_namep); }
+    };
+    struct NameRefEqual final {
+        bool operator()(const NameRef& lhs, const NameRef& rhs) const {
+            return *lhs.m_namep == *rhs.m_namep;
+        }
+    };
+
     // MEMBERS
     using NameMap = std::map<const std::string, uint64_t>;  // Sorted by name (ordered)
-    NameMap m_nameMap;  //< Name to point-number
+    NameMap m_nameMap;  //< Name to point-number, owns each name
+    std::unordered_map<NameRef, uint64_t, NameRefHash, NameRefEqual>
+        m_nameIndex;  //< Name to point-number, for fast lookup when merging
     std::vector<VlcPoint> m_points;  //< List of all points
     uint64_t m_numPoints = 0;  //< Total unique points
 
@@ -181,10 +198,18 @@ public:
         }
     }
     VlcPoint& pointNumber(uint64_t num) { return m_points[num]; }
+    uint64_t size() const { return m_numPoints; }
     uint64_t findAddPoint(const string& name, uint64_t count) {
-        const auto pair = m_nameMap.emplace(name, m_numPoints);
-        if (pair.second) m_points.emplace_back(name, m_numPoints++);
-        const uint64_t pointnum = pair.first->second;
+        const auto it = m_nameIndex.find(NameRef{&name});
+        uint64_t pointnum;
+        if (it != m_nameIndex.end()) {
+            pointnum = it->second;
+        } else {
+            pointnum = m_numPoints++;
+            const string* const namep = &m_nameMap.emplace(name, pointnum).first->first;
+            m_nameIndex.emplace(NameRef{namep}, pointnum);
+            m_points.emplace_back(namep, pointnum);
+        }
         m_points[pointnum].countInc(count);
         return pointnum;
     }
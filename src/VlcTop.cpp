@@ -24,12 +24,17 @@
 #include "VlcOptions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
@@ -165,41 +170,212 @@ void printTypeTally(const TypeTally& tally, size_t indent, bool includeMissingOr
     }
 }
 
+// Call fn(i) for each i in [0, n), on up to 'jobs' threads including this one
+void parallelFor(unsigned jobs, size_t n, const std::function<void(size_t)>& fn) {
+    const size_t nThreads = std::min<size_t>(jobs, n);
+    if (nThreads <= 1) {
+        for (size_t i = 0; i < n; ++i) fn(i);
+        return;
+    }
+    std::atomic<size_t> next{0};
+    const auto work = [&]() {
+        for (size_t i = next++; i < n; i = next++) fn(i);
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < nThreads; ++i) threads.emplace_back(work);
+    work();
+    for (std::thread& thread : threads) thread.join();
+}
+
 }  // namespace
 
 void VlcTop::readCoverage(const string& filename, bool nonfatal) {
-    UINFO(2, "readCoverage " << filename);
+    VlcCoverageFile file;
+    parseCoverage(filename, file);
+    mergeCoverage(filename, file, nonfatal);
+}
 
-    std::ifstream is{filename.c_str()};
-    if (!is) {
-        if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
+void VlcTop::readCoverages(const VlStringSet& filenames) {
+    const std::vector<string> files{filenames.begin(), filenames.end()};
+    const size_t nWorkers = std::min<size_t>(opt.jobs(), files.size());
+    if (nWorkers <= 1) {
+        for (const string& filename : files) readCoverage(filename);
         return;
     }
 
-    // Testrun and computrons argument unsupported as yet
-    VlcTest* const testp = tests().newTest(filename, 0, 0);
+    // Worker threads parse files into a bounded window of slots, while this
+    // thread merges them in file order.  Only the window is held in memory, and
+    // tests, point numbers and all output are the same as reading serially.
+    const size_t window = 4 * nWorkers;
+    std::vector<VlcCoverageFile> slots(window);
+    std::vector<bool> ready(window, false);
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t nextParse = 0;  // Next file to be claimed by a worker
+    size_t nextMerge = 0;  // Next file to be merged
+    bool stop = false;  // Stop claiming files, error pending
+
+    const auto worker = [&]() {
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                cv.wait(lock, [&]() { return stop || nextParse < nextMerge + window; });
+                if (stop || nextParse >= files.size()) return;
+                index = nextParse++;
+            }
+            VlcCoverageFile file;
+            parseCoverage(files[index], file);
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                slots[index % window] = std::move(file);
+                ready[index % window] = true;
+            }
+            cv.notify_all();
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < nWorkers; ++i) workers.emplace_back(worker);
+    const auto joinWorkers = [&]() {
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        cv.notify_all();
+        for (std::thread& thread : workers) thread.join();
+        workers.clear();
+    };
+
+    for (size_t index = 0; index < files.size(); ++index) {
+        VlcCoverageFile file;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [&]() { return ready[index % window]; });
+            file = std::move(slots[index % window]);
+            ready[index % window] = false;
+            nextMerge = index + 1;
+        }
+        cv.notify_all();
+        // Errors are fatal, so stop the workers before reporting
+        if (!file.m_opened || !file.m_error.empty()) joinWorkers();
+        mergeCoverage(files[index], file, false);
+    }
+    joinWorkers();
+}
+
+void VlcTop::parseCoverage(const string& filename, VlcCoverageFile& file) const {
+    std::ifstream is{filename.c_str()};
+    if (!is) return;
+    file.m_opened = true;
+
+    if (V3Os::getline(is) + '\n' == VL_COV_BINARY_MAGIC) {
+        is.close();
+        parseCoverageBinary(filename, file);
+        return;
+    }
+    is.clear();
+    is.seekg(0);
 
     while (!is.eof()) {
         const string line = V3Os::getline(is);
-        // UINFO(9, " got " << line);
         if (line[0] == 'C') {
             string::size_type secspace = 3;
             for (; secspace < line.length(); secspace++) {
                 if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
             }
-            const string point = line.substr(3, secspace - 3);
-            if (!opt.isTypeMatch(point.c_str())) continue;
-
+            string point = line.substr(3, secspace - 3);
             const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
-            // UINFO(9, "   point '" << point << "'" << " " << hits);
+            if (opt.isTypeMatch(point.c_str())) file.m_points.emplace_back(std::move(point), hits);
+        }
+    }
+}
 
-            const uint64_t pointnum = points().findAddPoint(point, hits);
-            if (opt.rank()) {  // Only if ranking - uses a lot of memory
-                if (hits >= VlcBuckets::sufficient()) {
-                    points().pointNumber(pointnum).testsCoveringInc();
-                    testp->buckets().addData(pointnum, hits);
-                }
+void VlcTop::parseCoverageBinary(const string& filename, VlcCoverageFile& file) const {
+    // See VL_COV_BINARY_MAGIC for the format
+    std::ifstream is{filename.c_str(), std::ios::in | std::ios::binary};
+    std::ostringstream contents;
+    contents << is.rdbuf();
+    const string buf = contents.str();
+    size_t pos = std::strlen(VL_COV_BINARY_MAGIC);
+    bool corrupt = false;
+    const auto get = [&](int bytes) -> uint64_t {
+        if (buf.size() - pos < static_cast<size_t>(bytes)) {
+            corrupt = true;
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(buf[pos + i])) << (8 * i);
+        }
+        pos += bytes;
+        return value;
+    };
+    // Each fragment and point takes at least 4 bytes, so check counts before allocating
+    const auto getCount = [&](int bytes) -> uint64_t {
+        const uint64_t count = get(bytes);
+        if (count > (buf.size() - pos) / 4) corrupt = true;
+        return corrupt ? 0 : count;
+    };
+
+    // Fragments
+    std::vector<string> fragments(getCount(4));
+    for (string& fragment : fragments) {
+        const size_t len = get(4);
+        if (corrupt || buf.size() - pos < len) {
+            corrupt = true;
+            break;
+        }
+        fragment = buf.substr(pos, len);
+        pos += len;
+    }
+    // Point names
+    const uint64_t nPoints = getCount(8);
+    std::vector<string> names;
+    names.reserve(nPoints);
+    for (uint64_t i = 0; i < nPoints && !corrupt; ++i) {
+        string name;
+        const uint32_t nFragments = get(4);
+        for (uint32_t j = 0; j < nFragments && !corrupt; ++j) {
+            const uint64_t fragment = get(4);
+            if (fragment >= fragments.size()) {
+                corrupt = true;
+                break;
             }
+            name += fragments[fragment];
+        }
+        names.emplace_back(std::move(name));
+    }
+    // Counts
+    for (string& name : names) {
+        const uint64_t hits = get(8);
+        if (corrupt) break;
+        if (opt.isTypeMatch(name.c_str())) file.m_points.emplace_back(std::move(name), hits);
+    }
+    if (corrupt) file.m_error = "Corrupt binary coverage file: " + filename;
+}
+
+void VlcTop::mergeCoverage(const string& filename, VlcCoverageFile& file, bool nonfatal) {
+    UINFO(2, "readCoverage " << filename);
+
+    if (!file.m_opened) {
+        if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
+        return;
+    }
+    if (!file.m_error.empty()) v3fatal(file.m_error);
+
+    // Testrun and computrons argument unsupported as yet
+    VlcTest* const testp = tests().newTest(filename, 0, 0);
+    for (const auto& pointHits : file.m_points) {
+        addPoint(testp, pointHits.first, pointHits.second);
+    }
+}
+
+void VlcTop::addPoint(VlcTest* testp, const string& point, uint64_t hits) {
+    const uint64_t pointnum = points().findAddPoint(point, hits);
+    if (opt.rank()) {  // Only if ranking - uses a lot of memory
+        if (hits >= VlcBuckets::sufficient()) {
+            points().pointNumber(pointnum).testsCoveringInc();
+            testp->buckets().addData(pointnum, hits);
         }
     }
 }
@@ -327,33 +503,65 @@ void VlcTop::rank() {
         if (pointp->testsCovering()) remaining.addData(pointp->pointNum(), 1);
     }
 
-    // Additional Greedy algorithm
-    // O(n^2) Ouch.  Probably the thing to do is randomize the order of data
-    // then hierarchically solve a small subset of tests, and take resulting
-    // solution and move up to larger subset of tests.  (Aka quick sort.)
-    while (true) {
+    // Additional Greedy algorithm, each iteration ranks the test covering the
+    // most remaining points, the earliest in 'bytime' on ties.
+    // A test's gain only shrinks as points are covered, so a gain computed in
+    // an earlier iteration is an upper bound ("lazy greedy").  Candidates are
+    // kept in a heap by bound, and only those on top that could still win are
+    // recomputed, in parallel.  Once the top is up to date it beats every other
+    // bound, which makes the same choice as rescanning all tests.
+    struct Candidate final {
+        uint64_t m_gain;  // Remaining points covered, or an upper bound if stale
+        size_t m_index;  // Index in bytime
+        uint64_t m_iter;  // Iteration m_gain was computed in
+    };
+    const auto heapCmp = [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.m_gain != rhs.m_gain) return lhs.m_gain < rhs.m_gain;
+        return lhs.m_index > rhs.m_index;
+    };
+    const auto refresh = [&](std::vector<Candidate>& cands, uint64_t iter) {
+        // Not worth starting threads for small bitmaps
+        const bool big = cands.size() * (points().size() / 64) >= 65536;
+        parallelFor(big ? opt.jobs() : 1, cands.size(), [&](size_t i) {
+            cands[i].m_gain = bytime[cands[i].m_index]->buckets().dataPopCount(remaining);
+            cands[i].m_iter = iter;
+        });
+    };
+    std::vector<Candidate> heap;
+    for (size_t i = 0; i < bytime.size(); ++i) heap.push_back(Candidate{0, i, 0});
+    refresh(heap, 0);
+    std::make_heap(heap.begin(), heap.end(), heapCmp);
+
+    const size_t batch = opt.jobs() * 4;
+    std::vector<Candidate> stale;
+    uint64_t iter = 0;
+    while (!heap.empty() && heap.front().m_gain) {
+        if (heap.front().m_iter != iter) {
+            stale.clear();
+            while (!heap.empty() && heap.front().m_iter != iter && stale.size() < batch) {
+                std::pop_heap(heap.begin(), heap.end(), heapCmp);
+                stale.push_back(heap.back());
+                heap.pop_back();
+            }
+            refresh(stale, iter);
+            for (const Candidate& cand : stale) {
+                heap.push_back(cand);
+                std::push_heap(heap.begin(), heap.end(), heapCmp);
+            }
+            continue;
+        }
         if (debug() >= 9) {
             UINFO_PREFIX("Left on iter" << nextrank << ": ");  // LCOV_EXCL_LINE
             remaining.dump();  // LCOV_EXCL_LINE
         }
-        VlcTest* bestTestp = nullptr;
-        uint64_t bestRemain = 0;
-        for (const auto& testp : bytime) {
-            if (!testp->rank()) {
-                const uint64_t remain = testp->buckets().dataPopCount(remaining);
-                if (remain > bestRemain) {
-                    bestTestp = testp;
-                    bestRemain = remain;
-                }
-            }
-        }
-        if (VlcTest* const testp = bestTestp) {
-            testp->rank(nextrank++);
-            testp->rankPoints(bestRemain);
-            remaining.orData(bestTestp->buckets());
-        } else {
-            break;  // No test covering more stuff found
-        }
+        std::pop_heap(heap.begin(), heap.end(), heapCmp);
+        const Candidate best = heap.back();
+        heap.pop_back();
+        VlcTest* const testp = bytime[best.m_index];
+        testp->rank(nextrank++);
+        testp->rankPoints(best.m_gain);
+        remaining.orData(testp->buckets());
+        ++iter;
     }
 }
 
@@ -25,6 +25,18 @@
 #include "VlcSource.h"
 #include "VlcTest.h"
 
+#include <utility>
+#include <vector>
+
+//######################################################################
+// VlcCoverageFile - Points read from one coverage file, not yet merged
+
+struct VlcCoverageFile final {
+    bool m_opened = false;  //< File could be opened
+    string m_error;  //< Reason the file is corrupt, empty if none
+    std::vector<std::pair<string, uint64_t>> m_points;  //< Filtered points, in file order
+};
+
 //######################################################################
 // VlcTop - Top level options container
 
@@ -39,9 +51,14 @@ private:
     VlcSources m_sources;  //< List of all source files to annotate
 
     // METHODS
+    void addPoint(VlcTest* testp, const string& point, uint64_t hits);
     void annotateCalc();
     void annotateCalcNeeded();
     void annotateOutputFiles(const string& dirname);
+    void mergeCoverage(const string& filename, VlcCoverageFile& file, bool nonfatal);
+    // Parsing only reads options, so it may run on any thread
+    void parseCoverage(const string& filename, VlcCoverageFile& file) const;
+    void parseCoverageBinary(const string& filename, VlcCoverageFile& file) const;
 
 public:
     // CONSTRUCTORS
@@ -58,6 +75,7 @@ public:
     void printHierarchyReport();
     void printTypeSummary();
     void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverages(const VlStringSet& filenames);
     void writeCoverage(const string& filename);
     void writeInfo(const string& filename);
 
@@ -277,6 +277,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_D_HIER_DPI "--hier-dpi"
 %token<fl>              yVLT_D_LEVELS   "--levels"
 %token<fl>              yVLT_D_LINES    "--lines"
+%token<fl>              yVLT_D_LOGIC    "--logic"
 %token<fl>              yVLT_D_MATCH    "--match"
 %token<fl>              yVLT_D_MODEL    "--model"
 %token<fl>              yVLT_D_MODULE   "--module"
@@ -8490,6 +8491,8 @@ vltItem:
                         { V3Control::addProfileData($<fl>1, *$2, $3->toUQuad()); }
         |       yVLT_PROFILE_DATA vltDModel vltDMtask vltDCost
                         { V3Control::addProfileData($<fl>1, *$2, *$3, $4->toUQuad()); }
+        |       yVLT_PROFILE_DATA vltDModel vltDLogic vltDCost
+                        { V3Control::addProfileLogicData($<fl>1, *$2, *$3, $4->toUQuad()); }
         |       yVLT_FSM_REGISTER_WRAPPER vltDModule vltDFsmD vltDFsmQ vltDFsmClock vltDFsmResetE vltDFsmResetValueE
                         { V3Control::addFsmRegisterWrapper($<fl>1, *$2, *$3, *$4, *$5, *$6, *$7); }
         |       yVLT_VERILATOR_LIB vltDModule
@@ -8562,6 +8565,10 @@ vltDLevels<nump>:  // --levels <arg>
                 yVLT_D_LEVELS yaINTNUM                  { $$ = $2; }
         ;
 
+vltDLogic<strp>:  // --logic <arg>
+                yVLT_D_LOGIC str                        { $$ = $2; }
+        ;
+
 vltDMatch<strp>:  // --match <arg>
                 yVLT_D_MATCH str                        { $$ = $2; }
         ;
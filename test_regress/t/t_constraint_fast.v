@@ -0,0 +1,95 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// Constraints each bounding one variable, solvable without the SMT solver
+class Simple;
+  rand bit [7:0] r;
+  rand int s;
+  rand bit [3:0] set;
+  rand bit [15:0] d;
+  rand bit [31:0] free;
+  rand bit b;
+  bit [7:0] limit = 20;
+
+  constraint c_range {r >= 10 && r < limit; r != 15;}
+  constraint c_signed {s > -4; s <= 3;}
+  constraint c_set {set inside {1, 3, [8:9]};}
+  constraint c_dist {d dist {100 := 1, [200:201] :/ 3};}
+  constraint c_soft {soft r == 12;}
+  constraint c_bit {b;}
+endclass
+
+// Kept apart from Simple, whose dist draws new constraint text each call,
+// which would start a new randc cycle every time
+class Cycle;
+  randc bit [2:0] c;
+  rand bit [3:0] x;
+  constraint c_randc {c < 6;}
+  constraint c_x {x inside {[1:4]};}
+endclass
+
+module t;
+  Simple p;
+  Cycle q;
+  int hits_r[256];
+  int hits_s[int];
+  int hits_set[16];
+  int seen_c[8];
+
+  initial begin
+    p = new;
+    p.c_soft.constraint_mode(0);
+    repeat (600) begin
+      if (p.randomize() != 1) $stop;
+      if (!(p.r >= 10 && p.r < 20 && p.r != 15)) $stop;
+      if (!(p.s > -4 && p.s <= 3)) $stop;
+      if (!(p.set inside {1, 3, 8, 9})) $stop;
+      if (!(p.d inside {100, 200, 201})) $stop;
+      if (p.b != 1) $stop;
+      ++hits_r[p.r];
+      ++hits_s[p.s];
+      ++hits_set[p.set];
+    end
+    // Every allowed value is reachable
+    for (int i = 10; i < 20; ++i) if ((i == 15) != (hits_r[i] == 0)) $stop;
+    if (hits_s.size() != 7) $stop;
+    if (hits_set[1] == 0 || hits_set[3] == 0 || hits_set[8] == 0 || hits_set[9] == 0) $stop;
+
+    // State-dependent bound follows the current value
+    p.limit = 12;
+    repeat (20) begin
+      if (p.randomize() != 1) $stop;
+      if (!(p.r >= 10 && p.r < 12)) $stop;
+    end
+
+    // Soft constraint holds when compatible
+    p.limit = 20;
+    p.c_soft.constraint_mode(1);
+    repeat (20) begin
+      if (p.randomize() != 1) $stop;
+      if (p.r != 12) $stop;
+    end
+
+    // randc visits each allowed value once per cycle
+    q = new;
+    repeat (3) begin
+      seen_c = '{default: 0};
+      repeat (6) begin
+        if (q.randomize() != 1) $stop;
+        if (!(q.c < 6 && q.x inside {[1:4]})) $stop;
+        ++seen_c[q.c];
+      end
+      for (int i = 0; i < 6; ++i) if (seen_c[i] != 1) $stop;
+    end
+
+    // Unsatisfiable state falls back to the solver and fails
+    p.limit = 5;
+    if (p.randomize() != 0) $stop;
+
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
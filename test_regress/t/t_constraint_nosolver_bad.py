@@ -14,7 +14,10 @@ test.top_filename = "t/t_constraint.v"
 
 test.compile()
 
-test.execute(run_env='VERILATOR_SOLVER=someimaginarysolver', fails=True)
+# Simple constraints are solved in-process unless the fast path is disabled
+test.execute(run_env='VERILATOR_SOLVER=someimaginarysolver',
+             all_run_flags=['+verilator+solver+fast+0'],
+             fails=True)
 
 # Not using golden file, as may get spurious pipe messages, see issue #6273
 test.file_grep(test.run_log_filename, r'Unable to communicate with SAT solver')
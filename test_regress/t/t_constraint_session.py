@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+if not test.have_solver:
+    test.skip("No constraint solver installed")
+
+test.compile()
+
+test.execute(all_run_flags=['+verilator+wno+unsatconstr+1'])
+
+# Log what each solver process is sent. With two processes Pair's session
+# stays in the first and Other's in the second, until the unsat call resets
+# Pair's and the final Pair call takes over the second process.
+solver_log = test.obj_dir + "/solver.log"
+
+test.execute(all_run_flags=[
+    '+verilator+wno+unsatconstr+1', '+verilator+solver+procs+2',
+    '+verilator+solver+file+' + solver_log
+])
+
+# Declarations and hard constraints are sent once for all the loop's calls;
+# Pair's declarations once more for the unsat core report
+test.file_grep_count(solver_log, r'^  \(declare-fun lo \(\)', 2)
+test.file_grep_count(solver_log, r'^  \(assert \(= #b1 \(__Vbv \(bvult lo hi\)\)\)\)', 1)
+test.file_grep_count(solver_log + ".1", r'^  \(declare-fun a \(\)', 1)
+test.file_grep_count(solver_log + ".1", r'^  \(assert \(= #b1 .*\(bvadd a b\)', 1)
+test.file_grep_count(solver_log + ".1", r'^  \(declare-fun lo \(\)', 1)
+
+test.passes()
@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// Repeated randomize() calls reusing the solver context, with state that
+// changes between calls and other classes interleaved
+class Pair;
+  rand bit [7:0] lo;
+  rand bit [7:0] hi;
+  bit [7:0] gap;
+  constraint c_order {lo < hi;}
+  constraint c_gap {hi - lo >= gap;}
+  constraint c_soft {soft lo == 3;}
+endclass
+
+class Other;
+  rand bit [3:0] a;
+  rand bit [3:0] b;
+  constraint c_sum {a + b == 4'd9;}
+endclass
+
+module t;
+  Pair p;
+  Other o;
+
+  initial begin
+    p = new;
+    o = new;
+    for (int i = 0; i < 40; ++i) begin
+      p.gap = 8'(i * 5);
+      if (p.randomize() != 1) $stop;
+      if (!(p.lo < p.hi && p.hi - p.lo >= p.gap)) $stop;
+      if (p.lo != 3 && p.gap <= 252) $stop;
+      if (i % 3 == 0) begin
+        if (o.randomize() != 1) $stop;
+        if (4'(o.a + o.b) != 4'd9) $stop;
+      end
+      if (i % 5 == 0) begin
+        if (p.randomize() with {hi == lo + gap + 8'd1;} != 1) $stop;
+        if (p.hi != p.lo + p.gap + 8'd1) $stop;
+      end
+      // Current values still satisfy the constraints
+      if (p.randomize(null) != 1) $stop;
+    end
+    // An unsatisfiable call, then the session recovers
+    if (p.randomize() with {lo > 8'd200; hi < 8'd100;} != 0) $stop;
+    p.gap = 8'd1;
+    if (p.randomize() != 1) $stop;
+    if (!(p.lo < p.hi)) $stop;
+
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
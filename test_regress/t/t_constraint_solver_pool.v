@@ -0,0 +1,74 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// Several classes interleaved over a pool of solver processes, taking
+// solutions solved ahead in batches
+class Pair;
+  rand bit [7:0] lo;
+  rand bit [7:0] hi;
+  bit [7:0] gap;
+  constraint c_gap {hi > lo + gap; lo < 8'd200 - gap;}
+endclass
+
+class Sum;
+  rand bit [3:0] a;
+  rand bit [3:0] b;
+  constraint c_sum {a + b == 4'd9;}
+  constraint c_soft {soft a == 4'd2;}
+endclass
+
+class Cyc;
+  randc bit [2:0] v;
+  rand bit [2:0] w;
+  constraint c_vw {v != w;}
+endclass
+
+module t;
+  Pair p;
+  Pair q;
+  Sum s;
+  Cyc c;
+  int seen[bit [15:0]];
+  bit [7:0] cycle[$];
+
+  initial begin
+    p = new;
+    q = new;
+    s = new;
+    c = new;
+    p.gap = 8'd10;
+    q.gap = 8'd10;
+    for (int i = 0; i < 48; ++i) begin
+      if (p.randomize() != 1) $stop;
+      if (!(p.hi > p.lo + p.gap && p.lo < 8'd200 - p.gap)) $stop;
+      seen[{p.lo, p.hi}] = 1;
+      // Same constraints and state, so may take a solution p's batch left
+      if (q.randomize() != 1) $stop;
+      if (!(q.hi > q.lo + q.gap && q.lo < 8'd200 - q.gap)) $stop;
+      if (s.randomize() != 1) $stop;
+      if (4'(s.a + s.b) != 4'd9 || s.a != 4'd2) $stop;
+      if (i % 8 == 0) begin
+        // New state value, new batch
+        q.gap = 8'(i);
+        if (p.randomize(null) != 1) $stop;
+      end
+    end
+    // Batches must still spread the values
+    if (seen.num() < 24) $stop;
+
+    // randc is never batched: each cycle covers every value once
+    for (int i = 0; i < 8; ++i) begin
+      if (c.randomize() != 1) $stop;
+      if (c.v == c.w) $stop;
+      cycle.push_back(8'(c.v));
+    end
+    cycle.sort();
+    foreach (cycle[i]) if (cycle[i] != 8'(i)) $stop;
+
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,56 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+
+#include <memory>
+#include <thread>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+// Each model randomizes on its own thread, sharing the solver process pool
+static void sim(VM_PREFIX* topp) {
+    VerilatedContext* const contextp = topp->contextp();
+    Verilated::threadContextp(contextp);
+    while (!contextp->gotFinish() && contextp->time() < 100) {
+        topp->eval();
+        contextp->timeInc(1);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::unique_ptr<VerilatedContext> context0p{new VerilatedContext};
+    std::unique_ptr<VerilatedContext> context1p{new VerilatedContext};
+    context0p->debug(0);
+    context1p->debug(0);
+    context0p->commandArgs(argc, argv);
+    context1p->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> top0p{new VM_PREFIX{context0p.get(), "top0"}};
+    std::unique_ptr<VM_PREFIX> top1p{new VM_PREFIX{context1p.get(), "top1"}};
+
+    std::thread thread0{sim, top0p.get()};
+    std::thread thread1{sim, top1p.get()};
+    thread0.join();
+    thread1.join();
+
+    TEST_CHECK_NZ(context0p->gotFinish());
+    TEST_CHECK_NZ(context1p->gotFinish());
+    top0p->final();
+    top1p->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_constraint_solver_pool.v"
+
+if not test.have_solver:
+    test.skip("No constraint solver installed")
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename])
+
+# Two models randomizing concurrently share the pool, so both solver
+# processes start and are leased from both threads
+test.execute(all_run_flags=[
+    "+verilator+solver+procs+2", "+verilator+solver+batch+8", "+verilator+solver+fast+0"
+])
+
+test.passes()
@@ -0,0 +1,89 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// VerilatedContext::signalFind typed views of public signals.
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_syms.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->clk = 0;
+    topp->eval();
+
+    TEST_CHECK_EQ(static_cast<bool>(contextp->signalFind("t.nonexistent")), false);
+    TEST_CHECK_EQ(static_cast<bool>(contextp->signalFind("nonexistent")), false);
+
+    const VerilatedSignal b8 = contextp->signalFind("t.b8");
+    TEST_CHECK_EQ(static_cast<bool>(b8), true);
+    TEST_CHECK_EQ(b8.vltype(), VLVT_UINT8);
+    TEST_CHECK_EQ(b8.bits(), 8U);
+    TEST_CHECK_EQ(b8.elements(), 1U);
+    TEST_CHECK_EQ(b8.writable(), true);
+    TEST_CHECK_HEX_EQ(b8.read(), 0x5a);
+    TEST_CHECK_HEX_EQ(*b8.data<CData>(), 0x5a);
+    TEST_CHECK_EQ(b8.generation(), contextp->scopesGeneration());
+
+    const VerilatedSignal w70 = contextp->signalFind("t.w70");
+    TEST_CHECK_EQ(w70.vltype(), VLVT_WDATA);
+    TEST_CHECK_EQ(w70.bits(), 70U);
+    TEST_CHECK_EQ(w70.writable(), false);
+    TEST_CHECK_HEX_EQ(w70.read(), 0xdeadbeef01234567ULL);
+    TEST_CHECK_HEX_EQ(w70.data<EData>()[2], 0x2a);
+
+    const VerilatedSignal mem = contextp->signalFind("t.mem");
+    TEST_CHECK_EQ(mem.bits(), 12U);
+    TEST_CHECK_EQ(mem.elements(), 4U);
+    TEST_CHECK_HEX_EQ(mem.read(2), 0x102);
+    mem.write(0xfff5, 1);  // Bits above the width are dropped
+    TEST_CHECK_HEX_EQ(mem.read(1), 0xff5);
+    TEST_CHECK_HEX_EQ(mem.read(0), 0x100);
+    TEST_CHECK_HEX_EQ(mem.read(3), 0x103);
+
+    const VerilatedSignal value = contextp->signalFind("t.u_sub.value");
+    TEST_CHECK_HEX_EQ(value.read(), 0x1234);
+
+    const VerilatedSignal clk = contextp->signalFind("clk");
+    TEST_CHECK_EQ(clk.data<CData>(), &topp->clk);
+
+    // Written values are seen by the model
+    const VerilatedSignal q40 = contextp->signalFind("t.q40");
+    const VerilatedSignal q40Copy = contextp->signalFind("t.q40_copy");
+    q40.write(0x123456789aULL);
+    for (int cycle = 0; cycle < 4 && !contextp->gotFinish(); ++cycle) {
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    TEST_CHECK_HEX_EQ(q40Copy.read(), 0x123456789aULL);
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    topp->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk  /*verilator public_flat_rd */
+);
+
+  reg [7:0] b8  /*verilator public_flat_rw */;
+  reg [39:0] q40  /*verilator public_flat_rw */;
+  reg [39:0] q40_copy  /*verilator public_flat_rd */;
+  reg [69:0] w70  /*verilator public_flat_rd */;
+  reg [11:0] mem[0:3]  /*verilator public_flat_rw */;
+
+  sub u_sub ();
+
+  initial begin
+    b8 = 8'h5a;
+    q40 = 0;
+    q40_copy = 0;
+    w70 = 70'h2a_deadbeef_01234567;
+    mem[0] = 12'h100;
+    mem[1] = 12'h101;
+    mem[2] = 12'h102;
+    mem[3] = 12'h103;
+  end
+
+  always @(posedge clk) begin
+    q40_copy <= q40;
+    if (q40 == 40'h12_3456789a) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
+
+module sub;
+  reg [15:0] value  /*verilator public_flat_rw */;
+  initial value = 16'h1234;
+endmodule
@@ -0,0 +1,205 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// Check the vectorized wide operators against plain word loops, and with
+// +benchmark report the time per operation for each width.
+//
+//*************************************************************************
+
+#include VM_PREFIX_INCLUDE
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static constexpr int MAX_WORDS = VL_WORDS_I(4096);
+
+//======================================================================
+// Reference implementations, one word at a time
+
+static void refAnd(int words, EData* owp, const EData* lwp, const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] & rwp[i];
+}
+static void refOr(int words, EData* owp, const EData* lwp, const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] | rwp[i];
+}
+static void refXor(int words, EData* owp, const EData* lwp, const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] ^ rwp[i];
+}
+static void refNot(int words, EData* owp, const EData* lwp) {
+    for (int i = 0; i < words; ++i) owp[i] = ~lwp[i];
+}
+static void refAdd(int words, EData* owp, const EData* lwp, const EData* rwp) {
+    QData carry = 0;
+    for (int i = 0; i < words; ++i) {
+        carry += static_cast<QData>(lwp[i]) + rwp[i];
+        owp[i] = static_cast<EData>(carry);
+        carry >>= 32;
+    }
+}
+static void refSub(int words, EData* owp, const EData* lwp, const EData* rwp) {
+    QData carry = 1;
+    for (int i = 0; i < words; ++i) {
+        carry += static_cast<QData>(lwp[i]) + static_cast<EData>(~rwp[i]);
+        owp[i] = static_cast<EData>(carry);
+        carry >>= 32;
+    }
+}
+static int refCmp(int words, const EData* lwp, const EData* rwp) {
+    for (int i = words - 1; i >= 0; --i) {
+        if (lwp[i] != rwp[i]) return lwp[i] > rwp[i] ? 1 : -1;
+    }
+    return 0;
+}
+static bool refBit(const EData* lwp, int bit) { return (lwp[bit / 32] >> (bit % 32)) & 1; }
+static void refShiftL(int obits, EData* owp, const EData* lwp, int sh) {
+    std::memset(owp, 0, VL_WORDS_I(obits) * sizeof(EData));
+    for (int bit = sh; bit < obits; ++bit) {
+        if (refBit(lwp, bit - sh)) owp[bit / 32] |= 1U << (bit % 32);
+    }
+}
+static void refShiftR(int obits, EData* owp, const EData* lwp, int sh) {
+    std::memset(owp, 0, VL_WORDS_I(obits) * sizeof(EData));
+    for (int bit = 0; bit + sh < obits; ++bit) {
+        if (refBit(lwp, bit + sh)) owp[bit / 32] |= 1U << (bit % 32);
+    }
+}
+
+//======================================================================
+
+static std::mt19937 s_rng{1};
+
+static void randomize(int bits, EData* wp) {
+    for (int i = 0; i < VL_WORDS_I(bits); ++i) wp[i] = s_rng();
+    wp[VL_WORDS_I(bits) - 1] &= VL_MASK_E(bits);
+}
+
+static void checkWords(int bits, const char* what, const EData* gotp, const EData* expp) {
+    for (int i = 0; i < VL_WORDS_I(bits); ++i) {
+        if (gotp[i] != expp[i]) {
+            std::cout << "%Error: " << what << " width " << bits << " word " << i << std::hex
+                      << ": GOT=" << gotp[i] << "   EXP=" << expp[i] << std::dec << std::endl;
+            ++errors;
+            return;
+        }
+    }
+}
+
+static void checkWidth(int bits) {
+    const int words = VL_WORDS_I(bits);
+    VlWide<MAX_WORDS> l;
+    VlWide<MAX_WORDS> r;
+    VlWide<MAX_WORDS> got;
+    VlWide<MAX_WORDS> exp;
+    for (int trial = 0; trial < 20; ++trial) {
+        randomize(bits, l.data());
+        randomize(bits, r.data());
+        // Make some upper words equal so comparisons look further down
+        const int sameWords = s_rng() % (words + 1);
+        for (int i = words - sameWords; i < words; ++i) r[i] = l[i];
+
+        VL_AND_W(words, got, l, r);
+        refAnd(words, exp.data(), l.data(), r.data());
+        checkWords(bits, "AND", got.data(), exp.data());
+        VL_OR_W(words, got, l, r);
+        refOr(words, exp.data(), l.data(), r.data());
+        checkWords(bits, "OR", got.data(), exp.data());
+        VL_XOR_W(words, got, l, r);
+        refXor(words, exp.data(), l.data(), r.data());
+        checkWords(bits, "XOR", got.data(), exp.data());
+        VL_NOT_W(words, got, l);
+        refNot(words, exp.data(), l.data());
+        checkWords(bits, "NOT", got.data(), exp.data());
+        VL_ADD_W(words, got, l, r);
+        refAdd(words, exp.data(), l.data(), r.data());
+        checkWords(bits, "ADD", got.data(), exp.data());
+        VL_SUB_W(words, got, l, r);
+        refSub(words, exp.data(), l.data(), r.data());
+        checkWords(bits, "SUB", got.data(), exp.data());
+
+        TEST_CHECK_EQ(VL_EQ_W(words, l, r), sameWords == words ? 1U : 0U);
+        TEST_CHECK_EQ(VL_EQ_W(words, l, l), 1U);
+        TEST_CHECK_EQ(VL_CHANGEXOR_W(words, l, r) != 0, sameWords != words);
+        TEST_CHECK_EQ(_vl_cmp_w(words, l, r), refCmp(words, l.data(), r.data()));
+        TEST_CHECK_EQ(_vl_cmp_w(words, r, l), refCmp(words, r.data(), l.data()));
+
+        const int sh = s_rng() % (bits + 8);
+        VL_SHIFTL_WWI(bits, bits, 32, got, l, sh);
+        got[words - 1] &= VL_MASK_E(bits);  // Result of shift left may be dirty
+        refShiftL(bits, exp.data(), l.data(), sh);
+        checkWords(bits, "SHIFTL", got.data(), exp.data());
+        VL_SHIFTR_WWI(bits, bits, 32, got, l, sh);
+        refShiftR(bits, exp.data(), l.data(), sh);
+        checkWords(bits, "SHIFTR", got.data(), exp.data());
+        // Shift in place as the emitted code may
+        got = l;
+        VL_SHIFTR_WWI(bits, bits, 32, got, got, sh);
+        checkWords(bits, "SHIFTR in place", got.data(), exp.data());
+    }
+    VL_ZERO_W(bits, l);
+    TEST_CHECK_EQ(VL_REDOR_W(words, l), 0U);
+    l[words - 1] = 1;
+    TEST_CHECK_EQ(VL_REDOR_W(words, l), 1U);
+}
+
+//======================================================================
+
+template <typename T_Func>
+static void benchmarkOne(int bits, const char* what, T_Func func) {
+    const int iterations = 20000000 / VL_WORDS_I(bits);
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) func();
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::printf("  %-7s %5d bits: %8.2f ns/op\n", what, bits, ns / iterations);
+}
+
+static void benchmarkWidth(int bits) {
+    const int words = VL_WORDS_I(bits);
+    VlWide<MAX_WORDS> l;
+    VlWide<MAX_WORDS> r;
+    VlWide<MAX_WORDS> o;
+    randomize(bits, l.data());
+    r = l;
+    r[0] ^= 1;  // Comparisons must scan all words
+    IData sink = 0;
+    benchmarkOne(bits, "AND", [&] { VL_AND_W(words, o, l, r); });
+    benchmarkOne(bits, "XOR", [&] { VL_XOR_W(words, o, l, r); });
+    benchmarkOne(bits, "ADD", [&] { VL_ADD_W(words, o, l, r); });
+    benchmarkOne(bits, "SUB", [&] { VL_SUB_W(words, o, l, r); });
+    benchmarkOne(bits, "EQ", [&] { sink += VL_EQ_W(words, l, o); });
+    benchmarkOne(bits, "LT", [&] { sink += VL_LT_W(words, l, r); });
+    benchmarkOne(bits, "SHIFTL", [&] { VL_SHIFTL_WWI(bits, bits, 32, o, l, 13); });
+    benchmarkOne(bits, "SHIFTR", [&] { VL_SHIFTR_WWI(bits, bits, 32, o, l, 13); });
+    if (sink == 0x12345678) std::printf("\n");  // Keep 'sink' alive
+}
+
+int main(int argc, char** argv) {
+    Verilated::commandArgs(argc, argv);
+    static const int widths[] = {65, 96, 127, 128, 129, 200, 255, 256, 257,
+                                 512, 513, 1000, 1024, 2048, 4095, 4096};
+    for (const int bits : widths) checkWidth(bits);
+
+    if (std::strlen(Verilated::commandArgsPlusMatch("benchmark"))) {
+        for (const int bits : widths) benchmarkWidth(bits);
+    }
+
+    if (errors) return 10;
+    std::printf("*-* All Finished *-*\n");
+    return 0;
+}
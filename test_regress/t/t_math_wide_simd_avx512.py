@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import os
+import re
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_math_wide_simd.v"
+test.pli_filename = "t/t_math_wide_simd.cpp"
+
+cpuinfo = ""
+if os.path.exists("/proc/cpuinfo"):
+    with open("/proc/cpuinfo", encoding="utf8") as fh:
+        cpuinfo = fh.read()
+if not re.search(r'^flags\s*:.*\bavx512f\b', cpuinfo, re.MULTILINE):
+    test.skip("No AVX-512 support on this host")
+
+# Same checks with the AVX-512 kernels compiled in
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename, "-CFLAGS", "-mavx512f"])
+
+test.execute(all_run_flags=(["+benchmark"] if test.benchmark else []))
+
+test.passes()
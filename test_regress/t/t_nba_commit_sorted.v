@@ -0,0 +1,104 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0)
+// verilog_format: on
+
+// Memories where the same elements are written multiple times in a cycle, which use the
+// sorted commit. Each is checked against a reference updated with blocking assignments.
+module t(clk);
+  input clk;
+
+  logic [31:0] cyc = 0;
+  reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+    if (cyc == 99) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+  // Case 1: two write ports to overlapping addresses, later port wins - sorted commit
+  logic [31:0] mem1[64];
+  logic [31:0] ref1[64];
+  always @(posedge clk) begin
+    if (cyc == 0) begin
+      for (int i = 0; i < 64; ++i) mem1[i] = 0;
+      for (int i = 0; i < 64; ++i) ref1[i] = 0;
+    end else begin
+      for (int i = 0; i < 64; ++i) `checkh(mem1[i], ref1[i]);
+      for (int i = 0; i < 12; ++i) begin
+        mem1[(int'(crc[5:0]) + i) % 64] <= cyc + i;
+        ref1[(int'(crc[5:0]) + i) % 64] = cyc + i;
+      end
+      for (int i = 0; i < 12; ++i) begin
+        mem1[(int'(crc[13:8]) + 2 * i) % 64] <= ~(cyc + i);
+        ref1[(int'(crc[13:8]) + 2 * i) % 64] = ~(cyc + i);
+      end
+    end
+  end
+
+  // Case 2: byte enables in a loop, partial updates - sorted commit
+  logic [63:0] mem2[32];
+  logic [63:0] ref2[32];
+  always @(posedge clk) begin
+    if (cyc == 0) begin
+      for (int i = 0; i < 32; ++i) mem2[i] = 0;
+      for (int i = 0; i < 32; ++i) ref2[i] = 0;
+    end else begin
+      for (int i = 0; i < 32; ++i) `checkh(mem2[i], ref2[i]);
+      for (int w = 0; w < 4; ++w) begin
+        for (int b = 0; b < 8; ++b) begin
+          if (crc[w * 8 + b]) begin
+            mem2[(int'(crc[20:16]) + w) % 32][b * 8 +: 8] <= cyc[7:0] + 8'(b);
+            ref2[(int'(crc[20:16]) + w) % 32][b * 8 +: 8] = cyc[7:0] + 8'(b);
+          end
+        end
+      end
+    end
+  end
+
+  // Case 3: wide elements, 2D, two write ports - sorted commit
+  logic [95:0] mem3[4][8];
+  logic [95:0] ref3[4][8];
+  always @(posedge clk) begin
+    if (cyc == 0) begin
+      for (int i = 0; i < 4; ++i) for (int j = 0; j < 8; ++j) mem3[i][j] = 0;
+      for (int i = 0; i < 4; ++i) for (int j = 0; j < 8; ++j) ref3[i][j] = 0;
+    end else begin
+      for (int i = 0; i < 4; ++i) for (int j = 0; j < 8; ++j) `checkh(mem3[i][j], ref3[i][j]);
+      for (int i = 0; i < 10; ++i) begin
+        mem3[crc[i +: 2]][crc[i + 8 +: 3]] <= {3{cyc + i}};
+        ref3[crc[i +: 2]][crc[i + 8 +: 3]] = {3{cyc + i}};
+      end
+      for (int i = 0; i < 10; ++i) begin
+        mem3[crc[i + 20 +: 2]][crc[i + 30 +: 3]] <= {crc[31:0], cyc, 32'(i)};
+        ref3[crc[i + 20 +: 2]][crc[i + 30 +: 3]] = {crc[31:0], cyc, 32'(i)};
+      end
+    end
+  end
+
+  // Case 4: single write port, distinct addresses - program order commit
+  logic [31:0] mem4[64];
+  logic [31:0] ref4[64];
+  always @(posedge clk) begin
+    if (cyc == 0) begin
+      for (int i = 0; i < 64; ++i) mem4[i] = 0;
+      for (int i = 0; i < 64; ++i) ref4[i] = 0;
+    end else begin
+      for (int i = 0; i < 64; ++i) `checkh(mem4[i], ref4[i]);
+      for (int i = 0; i < 16; ++i) begin
+        mem4[(int'(crc[5:0]) + i) % 64] <= cyc ^ i;
+        ref4[(int'(crc[5:0]) + i) % 64] = cyc ^ i;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_threads_dynamic.v"
+
+pgo_dir = test.obj_dir + "/pgo"
+
+test.compile(v_flags2=["--prof-pgo-auto", pgo_dir], threads=2)
+
+# Two runs, as if from different tests
+for run in ("a", "b"):
+    test.execute(all_run_flags=["+verilator+prof+vlt+file+" + pgo_dir + "/" + run + ".vlt"])
+
+test.file_grep(pgo_dir + "/a.vlt", r'profile_data -model "\S+" -mtask ')
+test.file_grep(pgo_dir + "/a.vlt", r'profile_data -model "\S+" -logic ')
+
+# Rerun with the same options, now reading both runs back in
+test.compile(v_flags2=["--prof-pgo-auto", pgo_dir], threads=2)
+
+test.execute(all_run_flags=["+verilator+prof+vlt+file+" + pgo_dir + "/a.vlt"])
+
+test.passes()
@@ -0,0 +1,128 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string readFile(const std::string& filename) {
+    std::ifstream is{filename, std::ios::binary};
+    std::ostringstream contents;
+    contents << is.rdbuf();
+    return contents.str();
+}
+
+int main(int argc, char* argv[]) {
+    std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    const std::string prefix = VL_STRINGIFY(TEST_OBJ_DIR) "/saved_";
+    // Reused across checkpoints, as incremental saves compare with the previous one
+    VerilatedSave incremental;
+    incremental.incremental(true);
+    VerilatedSave async;
+    async.async(true);
+    VerilatedSave both;
+    both.async(true);
+    both.incremental(true);
+    VerilatedSave compressed;
+    compressed.async(true);
+    compressed.compress(true);
+
+    // Checkpoint periodically, each mode must write the same file as a plain save
+    topp->clk = 0;
+    while (contextp->time() < 100) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+        if (contextp->time() % 25) continue;
+        {
+            VerilatedSave os;
+            os.open(prefix + "plain.vltsv");
+            os << contextp.get() << *topp;
+        }
+        incremental.open(prefix + "incremental.vltsv");
+        incremental << contextp.get() << *topp;
+        incremental.close();
+        async.open(prefix + "async.vltsv");
+        async << contextp.get() << *topp;
+        async.close();
+        both.open(prefix + "both.vltsv");
+        both << contextp.get() << *topp;
+        both.close();
+        compressed.open(prefix + "compressed.vltsv");
+        compressed << contextp.get() << *topp;
+        compressed.close();
+        async.wait();
+        both.wait();
+        compressed.wait();
+        const std::string plain = readFile(prefix + "plain.vltsv");
+        TEST_CHECK_Z(readFile(prefix + "incremental.vltsv") != plain);
+        TEST_CHECK_Z(readFile(prefix + "async.vltsv") != plain);
+        TEST_CHECK_Z(readFile(prefix + "both.vltsv") != plain);
+    }
+    // Later incremental checkpoints must have skipped the many unchanged blocks
+    TEST_CHECK_NZ(incremental.skippedBlocks());
+    TEST_CHECK_NZ(both.skippedBlocks());
+    TEST_CHECK_EQ(async.skippedBlocks(), 0);
+    TEST_CHECK_EQ(compressed.skippedBlocks(), 0);
+
+    // Restore the last compressed checkpoint into a new model and context, it must save the same
+    topp.reset();
+    contextp.reset(new VerilatedContext);
+    topp.reset(new VM_PREFIX{contextp.get(), "top"});
+    {
+        VerilatedRestore os;
+        os.open(prefix + "compressed.vltsv");
+        os >> contextp.get() >> *topp;
+    }
+    TEST_CHECK_EQ(contextp->time(), 100);
+    {
+        VerilatedSave os;
+        os.open(prefix + "restored.vltsv");
+        os << contextp.get() << *topp;
+    }
+    TEST_CHECK_Z(readFile(prefix + "restored.vltsv") != readFile(prefix + "plain.vltsv"));
+
+    // Restore the last incremental checkpoint into a new model and context, and finish from there
+    topp.reset();
+    contextp.reset(new VerilatedContext);
+    topp.reset(new VM_PREFIX{contextp.get(), "top"});
+    {
+        VerilatedRestore os;
+        os.open(prefix + "both.vltsv");
+        os >> contextp.get() >> *topp;
+    }
+    TEST_CHECK_EQ(contextp->time(), 100);
+    while (!contextp->gotFinish() && contextp->time() < 1000) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    TEST_CHECK_NZ(contextp->gotFinish());
+    topp->final();
+
+    return errors ? 10 : 0;
+}
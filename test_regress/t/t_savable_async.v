@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  // Large enough for many checkpoint blocks, with few changing per cycle
+  logic [31:0] mem[0:131071];
+  integer cyc = 0;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    mem[(cyc * 1021) % 131072] <= cyc;
+    if (cyc == 99) begin
+      for (int c = 1; c < 99; ++c) begin
+        if (mem[(c * 1021) % 131072] !== c) $stop;
+      end
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
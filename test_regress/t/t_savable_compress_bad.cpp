@@ -0,0 +1,65 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+int main(int argc, char* argv[]) {
+    std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    const std::string filename = VL_STRINGIFY(TEST_OBJ_DIR) "/saved.vltsv";
+    topp->clk = 0;
+    while (contextp->time() < 50) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    {
+        VerilatedSave os;
+        os.compress(true);
+        os.open(filename);
+        os << contextp.get() << *topp;
+    }
+
+    // Flip a byte in the first chunk, just after the file header
+    {
+        std::fstream fs{filename, std::ios::in | std::ios::out | std::ios::binary};
+        const std::streamoff offset = std::strlen("verilatorsavez1\n") + 64;
+        char byte;
+        fs.seekg(offset);
+        fs.read(&byte, 1);
+        byte ^= 0x5a;
+        fs.seekp(offset);
+        fs.write(&byte, 1);
+    }
+
+    // Restoring into a new model and context must fail, not load a corrupted model
+    topp.reset();
+    contextp.reset(new VerilatedContext);
+    topp.reset(new VM_PREFIX{contextp.get(), "top"});
+    {
+        VerilatedRestore os;
+        os.open(filename);
+        os >> contextp.get() >> *topp;
+    }
+    return 0;
+}
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=['--cc --threads-dynamic --prof-exec --stats'], threads=4)
+
+# With --prof-exec the threads record their idle time through a callback
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"),
+                   r'dynamicRun\(&\w+__Vmtask_idle__')
+
+# Profile several graphs, as a single one may finish before any thread runs out of work
+test.execute(all_run_flags=[
+    "+verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat",
+    " +verilator+prof+exec+window+10"])  # yapf:disable
+
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROF stat threads')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROFEXEC MTASK_BEGIN')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROFEXEC THREAD_SCHEDULE_WAIT_BEGIN')
+
+# Without spinning, idle threads sleep until work is pushed or the graph is done
+test.execute(all_run_flags=["+verilator+threads+spin+limit+0"])
+
+test.passes()
@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  logic [63:0] crc0 = 64'h5aef0c8d_d70a4497;
+  logic [63:0] crc1 = 64'h12345678_9abcdef0;
+  logic [63:0] crc2 = 64'h0fedcba9_87654321;
+  logic [63:0] crc3 = 64'hdeadbeef_cafef00d;
+  logic [63:0] acc = '0;
+  wire [63:0] mix = acc ^ (crc0 + crc1) ^ (crc2 - crc3);
+
+  // Independent chains, so there are multiple mtasks to run in parallel
+  always @(posedge clk) crc0 <= {crc0[62:0], crc0[63] ^ crc0[2] ^ crc0[0]};
+  always @(posedge clk) crc1 <= {crc1[62:0], crc1[63] ^ crc1[2] ^ crc1[0]};
+  always @(posedge clk) crc2 <= {crc2[62:0], crc2[63] ^ crc2[2] ^ crc2[0]};
+  always @(posedge clk) crc3 <= {crc3[62:0], crc3[63] ^ crc3[2] ^ crc3[0]};
+  // Which all feed this one
+  always @(posedge clk) acc <= {mix[62:0], mix[63]};
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 99) begin
+      `checkh(crc0, 64'h8ef77366f09d4122);
+      `checkh(crc1, 64'hf2d7f13ac8aab410);
+      `checkh(crc2, 64'hc243b5309bfe2e6e);
+      `checkh(crc3, 64'hbff13a32995f5d5c);
+      `checkh(acc, 64'he947b91b926086b3);
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_threads_dynamic.v"
+
+test.compile(verilator_flags2=['--cc --threads-numa-place --stats'], threads=4)
+
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "__Syms*.cpp"),
+                   r'numaPlace\(')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,54 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+// Generated header
+#include "Vt_threads_shared_pool.h"
+// General headers
+#include "verilated.h"
+
+#include "TestCheck.h"
+
+#include <thread>
+#include <vector>
+
+int errors = 0;
+
+// Each simulation runs on its own thread, in its own context, with the
+// worker threads of all contexts leased from the shared pool
+static void sim(int index) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->threads(2);
+    TEST_CHECK_EQ(contextp->useSharedThreadPool(), false);
+    contextp->useSharedThreadPool(true);
+    TEST_CHECK_EQ(contextp->useSharedThreadPool(), true);
+    // Shared workers spin as their latest lessee or task asks, including not at all
+    contextp->threadsSpinLimit(index % 2 ? 0 : 100);
+    const std::unique_ptr<VM_PREFIX> topp{
+        new VM_PREFIX{contextp.get(), ("top" + std::to_string(index)).c_str()}};
+
+    topp->clk = 0;
+    topp->eval();
+    while (contextp->time() < 1000 && !contextp->gotFinish()) {
+        contextp->timeInc(5);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    TEST_CHECK_EQ(contextp->gotFinish(), true);
+    topp->final();
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) threads.emplace_back(sim, i);
+    for (std::thread& thread : threads) thread.join();
+    return (errors ? 10 : 0);
+}
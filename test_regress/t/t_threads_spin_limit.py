@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_threads_dynamic.v"
+
+test.compile(verilator_flags2=['--cc --prof-exec'], threads=4)
+
+# Sleep immediately, so every blocked wait uses the futex path
+test.execute(all_run_flags=[
+    "+verilator+threads+spin+limit+0",
+    " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])  # yapf:disable
+
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROF stat waits_spun \d+')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROF stat waits_slept \d+')
+
+test.passes()
@@ -0,0 +1,121 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_timing.h"
+
+#include "TestCheck.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+int errors = 0;
+
+//======================================================================
+// The multimap based delay queue VlDelayScheduler used before the timing wheel, as reference
+
+class RefDelayScheduler final {
+    VerilatedContext& m_context;
+    std::multimap<uint64_t, VlCoroutineHandle> m_queue;
+
+public:
+    explicit RefDelayScheduler(VerilatedContext& context)
+        : m_context{context} {}
+    void resume() {
+        while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
+            VlCoroutineHandle handle = std::move(m_queue.begin()->second);
+            m_queue.erase(m_queue.begin());
+            handle.resume();
+        }
+    }
+    uint64_t nextTimeSlot() const { return m_queue.cbegin()->first; }
+    bool empty() const { return m_queue.empty(); }
+    auto delay(uint64_t delay, VlProcessRef) {
+        struct Awaitable final {
+            std::multimap<uint64_t, VlCoroutineHandle>& queue;
+            const uint64_t time;
+            bool await_ready() const { return false; }
+            void await_suspend(std::coroutine_handle<> coro) {
+                queue.emplace(time, VlCoroutineHandle{coro, nullptr, VlFileLineDebug{}});
+            }
+            void await_resume() const {}
+        };
+        return Awaitable{m_queue, m_context.time() + delay};
+    }
+};
+
+//======================================================================
+// Workload: processes looping on a fixed delay, logging (time, id) on every wakeup
+
+using Wakeups = std::vector<std::pair<uint64_t, int>>;
+
+template <typename T_Sched>
+VlCoroutine periodic(VerilatedContext& context, T_Sched& sched, Wakeups& log, int id,
+                     uint64_t period, int count) {
+    for (int i = 0; i < count; ++i) {
+        co_await sched.delay(period, nullptr);
+        log.emplace_back(context.time(), id);
+    }
+}
+
+template <typename T_Sched>
+double run(Wakeups& log, int count) {
+    // Mostly clock-like near delays, some mid-range, a few far beyond the wheel
+    static const uint64_t periods[]
+        = {1, 2, 5, 5, 5, 10, 10, 37, 256, 300, 5000, 70000, 1000003, 1ULL << 33};
+    VerilatedContext context;
+    T_Sched sched{context};
+    const auto start = std::chrono::steady_clock::now();
+    int id = 0;
+    for (uint64_t period : periods) {
+        for (int copy = 0; copy < 8; ++copy) {
+            periodic(context, sched, log, id++, period, period < 1000 ? count : count / 100 + 1);
+        }
+    }
+    while (!sched.empty()) {
+        context.time(sched.nextTimeSlot());
+        sched.resume();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / log.size();
+}
+
+//======================================================================
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    while (!contextp->gotFinish()) {
+        topp->eval();
+        if (!topp->eventsPending()) break;
+        contextp->time(topp->nextTimeSlot());
+    }
+    TEST_CHECK_NZ(contextp->gotFinish());
+    topp->final();
+
+    // Same wakeup order as the multimap reference, and a relative benchmark
+    const int count = 20000;
+    Wakeups wheelLog;
+    Wakeups refLog;
+    const double wheelNs = run<VlDelayScheduler>(wheelLog, count);
+    const double refNs = run<RefDelayScheduler>(refLog, count);
+    TEST_CHECK_EQ(wheelLog.size(), refLog.size());
+    TEST_CHECK_Z(wheelLog != refLog);
+    VL_PRINTF("Delay scheduling: timing wheel %0.1f ns/wakeup, multimap %0.1f ns/wakeup\n",
+              wheelNs, refNs);
+
+    return errors ? 10 : 0;
+}
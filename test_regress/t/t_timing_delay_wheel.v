@@ -0,0 +1,61 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+`timescale 1ns / 1ps
+
+module t;
+
+  // Delays spanning every level of the timing wheel, and beyond it
+  int fast_ticks = 0;
+  int clk_ticks = 0;
+  int slow_ticks = 0;
+  int order = 0;
+  time far_at = 0;
+
+  initial repeat (1000) #1ps fast_ticks++;
+  initial begin
+    repeat (1000) #5 clk_ticks++;
+    `checkd($time, 5000);
+  end
+  initial begin
+    repeat (100) #70us slow_ticks++;
+    `checkd($time, 7_000_000);
+  end
+
+  initial begin
+    #10s;
+    far_at = $time;
+  end
+
+  // Processes waking in the same time slot resume in scheduling order
+  initial begin
+    #3;
+    `checkd(order, 0);
+    order = 1;
+  end
+  initial begin
+    #3;
+    `checkd(order, 1);
+    order = 2;
+  end
+
+  initial begin
+    #(10s + 1ns);
+    `checkd(far_at, 10 * 64'd1_000_000_000);
+    `checkd(order, 2);
+    `checkd(fast_ticks, 1000);
+    `checkd(clk_ticks, 1000);
+    `checkd(slow_ticks, 100);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--binary", "-Wno-ZERODLY"])
+
+# Runtime statistics are only reported on request
+test.execute()
+test.file_grep_not(test.run_log_filename, r'coroutine frames')
+
+# Coroutine frames of finished processes are reused
+test.execute(all_run_flags=["+verilator+stats"], logfile=test.obj_dir + "/vlt_stats.log")
+test.file_grep(test.obj_dir + "/vlt_stats.log", r'coroutine frames \d+ allocated, [0-9.]+% reused')
+
+test.passes()
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t;
+
+  int sum = 0;
+  int done = 0;
+
+  task automatic work(int n);
+    #(n % 3);
+    sum += n;
+    done++;
+  endtask
+
+  initial begin
+    // Many short-lived processes, created and finished in waves
+    for (int wave = 0; wave < 100; wave++) begin
+      for (int i = 0; i < 100; i++) begin
+        fork
+          work(i);
+        join_none
+      end
+      wait (done == (wave + 1) * 100);
+    end
+    `checkd(sum, 100 * 4950);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=["--binary --stats"])
+
+# Only the agents are isolated, not the checker reading their results
+test.file_grep(test.stats, r'Timing, isolated processes\s+(\d+)', 16)
+
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp")
+test.file_grep_any(files, r'delayIsolated')
+
+test.execute()
+
+test.passes()
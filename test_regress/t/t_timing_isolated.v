@@ -0,0 +1,57 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define STRINGIFY(x) `"x`"
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+// Independent agents, each only touching its own state between delays
+module agent #(
+    parameter int ID = 0
+) (
+    output int result
+);
+  int acc = 0;
+  assign result = acc;
+
+  initial begin
+    for (int n = 0; n < 100; n++) begin
+      #(ID % 3 + 1);
+      acc = acc + ID + n;
+    end
+  end
+endmodule
+
+module t;
+  localparam int N = 16;
+
+  int results[N];
+
+  for (genvar i = 0; i < N; i++) begin : gen
+    agent #(.ID(i)) u_agent (.result(results[i]));
+  end
+
+`ifdef WAVES
+  initial begin
+    $dumpfile(`STRINGIFY(`TEST_DUMPFILE));
+    $dumpvars;
+  end
+`endif
+
+  // Not isolated: reads what the agents write, and has side effects
+  initial begin
+    int sum;
+    #1000;
+    sum = 0;
+    for (int i = 0; i < N; i++) sum += results[i];
+    `checkd(sum, 100 * (N * (N - 1) / 2) + N * 4950);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_timing_isolated.v"
+
+test.compile(verilator_flags2=["--binary --stats --trace-vcd -DWAVES"])
+
+# Tracing must not prevent isolation
+test.file_grep(test.stats, r'Timing, isolated processes\s+(\d+)', 16)
+
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp")
+test.file_grep_any(files, r'delayIsolated')
+
+test.execute()
+
+# Golden is from --threads 1, where no process is isolated
+test.vcd_identical(test.trace_filename, test.golden_filename)
+
+test.passes()
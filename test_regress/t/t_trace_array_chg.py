@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--trace-vcd"])
+
+trace_cpp = test.obj_dir + "/V" + test.name + "__Trace__0.cpp"
+for kind in ("Bit", "CData", "SData", "IData", "QData"):
+    test.file_grep_count(trace_cpp, r'bufp->chg' + kind + r'Array\(', 1)
+
+# Descending (8 elements) and small (4 elements) arrays are still traced element by element
+test.file_grep_count(trace_cpp, r'bufp->chgIData\(oldp\+\d+,\(__VdtypeVar\[\d+\]\),32\)', 12)
+
+test.execute()
+
+# Array compares must skip unchanged elements yet emit every change
+test.vcd_identical(test.trace_filename, test.golden_filename)
+
+test.passes()
@@ -0,0 +1,35 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  integer cyc = 0;
+
+  logic bits[16];
+  logic [6:0] bytes[0:9];
+  logic [12:0] shorts[12];
+  logic [31:0] ints[8];
+  logic [63:0] quads[9];
+  logic [31:0] desc[7:0];  // Descending, traced element by element
+  logic [31:0] few[4];  // Too few elements for an array compare
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    bits[cyc%16] <= ~bits[cyc%16];
+    bytes[cyc%10] <= 7'(cyc);
+    shorts[cyc%12] <= 13'(cyc * 3);
+    ints[cyc%8] <= cyc * 32'h01010101;
+    quads[cyc%9] <= {32'(cyc), 32'hfeedface};
+    desc[cyc%8] <= cyc;
+    few[cyc%4] <= cyc;
+    if (cyc == 20) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
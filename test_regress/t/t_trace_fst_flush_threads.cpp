@@ -0,0 +1,51 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_fst_c.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include VM_PREFIX_INCLUDE
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->traceEverOn(true);
+    contextp->commandArgs(argc, argv);
+
+    const std::string name = contextp->commandArgsPlusMatch("fst_name+");
+    const std::string threads = contextp->commandArgsPlusMatch("fst_flush_threads+");
+    const std::string filename = std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/"}
+                                 + name.substr(std::strlen("+fst_name+")) + ".fst";
+
+    const std::unique_ptr<VM_PREFIX> top{new VM_PREFIX{contextp.get(), "top"}};
+    const std::unique_ptr<VerilatedFstC> tfp{new VerilatedFstC};
+    if (!threads.empty()) {
+        tfp->flushThreads(std::atoi(threads.c_str() + std::strlen("+fst_flush_threads+")));
+    }
+    top->trace(tfp.get(), 99);
+    tfp->open(filename.c_str());
+
+    top->clk = 0;
+    while (contextp->time() < 4000) {
+        top->clk = !top->clk;
+        top->eval();
+        tfp->dump(contextp->time());
+        // Cut many value change blocks, so several are in flight with threads
+        if (contextp->time() % 250 == 0) tfp->flush();
+        contextp->timeInc(1);
+    }
+    top->final();
+    tfp->close();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", "--trace-fst", test.pli_filename])
+
+# Same model, once writing blocks serially, once packing them on background threads
+test.execute(all_run_flags=["+fst_name+serial"])
+test.execute(all_run_flags=["+fst_name+parallel", "+fst_flush_threads+4"])
+
+# Parallel packing must give the same waveform
+test.fst_identical(test.obj_dir + "/parallel.fst", test.obj_dir + "/serial.fst")
+
+test.passes()
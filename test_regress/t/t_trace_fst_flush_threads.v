@@ -0,0 +1,24 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input wire clk
+);
+
+  integer cyc = 0;
+  logic [7:0] narrow = 8'h0;
+  logic [63:0] quad = 64'h1;
+  logic [127:0] wide = 128'h0;
+  logic [15:0] mem[16];
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    narrow <= narrow + 8'd3;
+    quad <= {quad[62:0], quad[63] ^ quad[61]};
+    wide <= {wide[126:0], ~wide[127]};
+    mem[cyc[3:0]] <= cyc[15:0] * 16'd7;
+  end
+endmodule
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t_trace_cat.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+vcd = test.obj_dir + "/simtrigger.vcd"
+# Dumps before the held back window are never written
+test.file_grep_not(vcd, r'^#119$')
+# The window starts with a full dump, including the unchanging signals
+test.file_grep(vcd, r'^#120\n([^#].*\n)*b0*101010 ')
+test.file_grep(vcd, r'^#150$')
+test.file_grep(vcd, r'^#179$')
+
+test.passes()
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import shutil
+
+test.scenarios('vlt')
+test.top_filename = "t/t_cover_line.v"
+
+test.compile(verilator_flags2=['--cc --coverage +define+ATTRIBUTE'])
+
+# The driver's main writes coverage.dat, so keep the text file before the binary run
+test.execute()
+shutil.copy(test.obj_dir + "/coverage.dat", test.obj_dir + "/coverage_text.dat")
+test.execute(all_run_flags=[" +verilator+coverage+binary"])
+shutil.copy(test.obj_dir + "/coverage.dat", test.obj_dir + "/coverage_bin.dat")
+
+test.file_grep(test.obj_dir + "/coverage_bin.dat", r"SystemC::Coverage-3-binary")
+
+# Reading the binary file gives the same points and counts as the text file
+for name in ["coverage_text", "coverage_bin"]:
+    test.run(cmd=[os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+                  test.obj_dir + "/" + name + ".dat",
+                  "--write", test.obj_dir + "/" + name + "_rewrite.dat"],
+             verilator_run=True)  # yapf:disable
+
+test.files_identical(test.obj_dir + "/coverage_bin_rewrite.dat",
+                     test.obj_dir + "/coverage_text_rewrite.dat")
+
+test.passes()
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('dist')
+
+# Parallel reading and ranking must match the serial results
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage", "-j", "3", "--rank",
+    "--write", test.obj_dir + "/coverage.dat", "t/t_vlcov_data_a.dat", "t/t_vlcov_data_b.dat",
+    "t/t_vlcov_data_c.dat", "t/t_vlcov_data_d.dat"
+],
+         logfile=test.obj_dir + "/vlcov.log",
+         tee=False,
+         verilator_run=True)
+
+test.files_identical(test.obj_dir + "/vlcov.log", test.t_dir + "/t_vlcov_rank.out")
+test.files_identical_sorted(test.obj_dir + "/coverage.dat", test.t_dir + "/t_vlcov_merge.out")
+
+test.passes()
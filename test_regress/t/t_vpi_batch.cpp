@@ -0,0 +1,176 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// VerilatedVpiBatch reads and writes of many signals at once.
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+unsigned main_time = 0;
+
+template <typename T>
+static T buffer_get(const std::vector<uint8_t>& buf, size_t offset) {
+    T value;
+    std::memcpy(&value, buf.data() + offset, sizeof(value));
+    return value;
+}
+
+template <typename T>
+static void buffer_put(std::vector<uint8_t>& buf, size_t offset, T value) {
+    std::memcpy(buf.data() + offset, &value, sizeof(value));
+}
+
+static bool batch_add(VerilatedVpiBatch& batch, const char* name) {
+    TestVpiHandle vh = VPI_HANDLE(name);
+    TEST_CHECK_NZ(vh);
+    const bool added = batch.add(vh);
+    // Failure is reported as a VPI error
+    s_vpi_error_info info;
+    TEST_CHECK_EQ(vpi_chk_error(&info) != 0, !added);
+    return added;
+}
+
+static uint64_t get_q(const char* name) {
+    TestVpiHandle vh = VPI_HANDLE(name);
+    s_vpi_value v;
+    v.format = vpiHexStrVal;
+    vpi_get_value(vh, &v);
+    // Lower 64 bits
+    const size_t len = std::strlen(v.value.str);
+    return std::strtoull(v.value.str + (len > 16 ? len - 16 : 0), nullptr, 16);
+}
+
+static void check_batch() {
+    VerilatedVpiBatch batch;
+    TEST_CHECK_EQ(batch_add(batch, "b8"), true);
+    TEST_CHECK_EQ(batch_add(batch, "s12"), true);
+    TEST_CHECK_EQ(batch_add(batch, "i32"), true);
+    TEST_CHECK_EQ(batch_add(batch, "q40"), true);
+    TEST_CHECK_EQ(batch_add(batch, "w70"), true);
+    for (int i = 0; i < 4; ++i) {
+        const std::string name = "mem[" + std::to_string(i) + "]";
+        TEST_CHECK_EQ(batch_add(batch, name.c_str()), true);
+    }
+    TEST_CHECK_EQ(batch_add(batch, "r"), true);
+    TEST_CHECK_EQ(batch.size(), 10U);
+
+    // Whole unpacked arrays and part selects are not batched
+    TEST_CHECK_EQ(batch_add(batch, "mem"), false);
+    TEST_CHECK_EQ(batch_add(batch, "i32[7:0]"), false);
+    TEST_CHECK_EQ(batch.size(), 10U);
+
+    std::vector<uint8_t> buf(batch.bufferSize());
+    batch.getValues(buf.data());
+    TEST_CHECK_HEX_EQ(buffer_get<CData>(buf, batch.offset(0)), 0x12);
+    TEST_CHECK_HEX_EQ(buffer_get<SData>(buf, batch.offset(1)), 0x345);
+    TEST_CHECK_HEX_EQ(buffer_get<IData>(buf, batch.offset(2)), 0x6789abcd);
+    TEST_CHECK_HEX_EQ(buffer_get<QData>(buf, batch.offset(3)), 0xef01234567ULL);
+    TEST_CHECK_HEX_EQ(buffer_get<EData>(buf, batch.offset(4)), 0x44556677);
+    TEST_CHECK_HEX_EQ(buffer_get<EData>(buf, batch.offset(4) + 4), 0x00112233);
+    TEST_CHECK_HEX_EQ(buffer_get<EData>(buf, batch.offset(4) + 8), 0x3f);
+    for (int i = 0; i < 4; ++i) {
+        TEST_CHECK_HEX_EQ(buffer_get<CData>(buf, batch.offset(5 + i)), 0x10 + i);
+    }
+    TEST_CHECK_EQ(buffer_get<double>(buf, batch.offset(9)), 1.5);
+
+    // Write new values, including bits beyond each width that must be dropped
+    buffer_put<CData>(buf, batch.offset(0), 0xa5);
+    buffer_put<SData>(buf, batch.offset(1), 0xffff);
+    buffer_put<IData>(buf, batch.offset(2), 0x01020304);
+    buffer_put<QData>(buf, batch.offset(3), 0xffffff8000000001ULL);
+    buffer_put<EData>(buf, batch.offset(4), 1);
+    buffer_put<EData>(buf, batch.offset(4) + 4, 2);
+    buffer_put<EData>(buf, batch.offset(4) + 8, 0xffffffff);
+    for (int i = 0; i < 4; ++i) buffer_put<CData>(buf, batch.offset(5 + i), 0x20 + i);
+    buffer_put<double>(buf, batch.offset(9), -2.25);
+    VerilatedVpi::clearEvalNeeded();
+    TEST_CHECK_EQ(batch.putValues(buf.data()), true);
+    TEST_CHECK_EQ(VerilatedVpi::evalNeeded(), true);
+
+    TEST_CHECK_HEX_EQ(get_q("b8"), 0xa5);
+    TEST_CHECK_HEX_EQ(get_q("s12"), 0xfff);
+    TEST_CHECK_HEX_EQ(get_q("i32"), 0x01020304);
+    TEST_CHECK_HEX_EQ(get_q("q40"), 0x8000000001ULL);
+    TEST_CHECK_HEX_EQ(get_q("w70"), 0x0000000200000001ULL);
+    TEST_CHECK_HEX_EQ(get_q("mem[3]"), 0x23);
+    {
+        TestVpiHandle vh = VPI_HANDLE("r");
+        s_vpi_value v;
+        v.format = vpiRealVal;
+        vpi_get_value(vh, &v);
+        TEST_CHECK_EQ(v.value.real, -2.25);
+    }
+
+    // Reading back gives the written values, masked to their widths
+    std::vector<uint8_t> back(batch.bufferSize());
+    batch.getValues(back.data());
+    TEST_CHECK_HEX_EQ(buffer_get<SData>(back, batch.offset(1)), 0xfff);
+    TEST_CHECK_HEX_EQ(buffer_get<EData>(back, batch.offset(4) + 8), 0x3f);
+
+    // Read-only signals can be read but not written
+    VerilatedVpiBatch roBatch;
+    TEST_CHECK_EQ(batch_add(roBatch, "ro"), true);
+    std::vector<uint8_t> roBuf(roBatch.bufferSize());
+    roBatch.getValues(roBuf.data());
+    TEST_CHECK_HEX_EQ(buffer_get<SData>(roBuf, 0), 0xbeef);
+    TEST_CHECK_EQ(roBatch.putValues(roBuf.data()), false);
+    s_vpi_error_info info;
+    TEST_CHECK_EQ(vpi_chk_error(&info), vpiError);
+}
+
+double sc_time_stamp() { return main_time; }
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    contextp->fatalOnVpiError(false);  // Unsupported handles are expected to be rejected
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+    topp->clk = 0;
+
+    check_batch();
+
+    while (main_time < 100 && !contextp->gotFinish()) {
+        main_time += 1;
+        topp->clk = !topp->clk;
+        topp->eval();
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    topp->final();
+    return errors ? 10 : 0;
+}
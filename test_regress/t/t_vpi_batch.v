@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  reg [7:0] b8  /*verilator public_flat_rw */;
+  reg [11:0] s12  /*verilator public_flat_rw */;
+  reg [31:0] i32  /*verilator public_flat_rw */;
+  reg [39:0] q40  /*verilator public_flat_rw */;
+  reg [69:0] w70  /*verilator public_flat_rw */;
+  reg [7:0] mem[0:3]  /*verilator public_flat_rw */;
+  real r  /*verilator public_flat_rw */;
+  reg [15:0] ro  /*verilator public_flat_rd */;
+
+  integer cyc = 0;
+
+  initial begin
+    b8 = 8'h12;
+    s12 = 12'h345;
+    i32 = 32'h6789abcd;
+    q40 = 40'hef_01234567;
+    w70 = 70'h3f_00112233_44556677;
+    mem[0] = 8'h10;
+    mem[1] = 8'h11;
+    mem[2] = 8'h12;
+    mem[3] = 8'h13;
+    r = 1.5;
+    ro = 16'hbeef;
+  end
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 4) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
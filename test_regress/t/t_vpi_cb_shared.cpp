@@ -0,0 +1,153 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// Many cbValueChange callbacks on the same signals, removed and registered
+// from within callbacks.
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+constexpr int N_COUNT_CBS = 1000;  // Callbacks on 'count'
+
+unsigned main_time = 0;
+int count_calls = 0;  // Calls of callbacks on 'count'
+int slow_calls = 0;  // Calls of callbacks on 'slow'
+int wide_calls = 0;  // Calls of callbacks on 'wide'
+int late_calls = 0;  // Calls of the callback registered from a callback
+uint64_t last_id = 0;  // Order check
+std::vector<vpiHandle> count_cbs;
+vpiHandle late_cb = nullptr;
+
+static vpiHandle register_cb(const char* name, PLI_INT32 (*cb_rtn)(p_cb_data), uint64_t id) {
+    TestVpiHandle vh = VPI_HANDLE(name);
+    TEST_CHECK_NZ(vh);
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    t_cb_data cb_data;
+    bzero(&cb_data, sizeof(cb_data));
+    cb_data.reason = cbValueChange;
+    cb_data.cb_rtn = cb_rtn;
+    cb_data.obj = vh;
+    cb_data.value = &v;
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(id);
+    vpiHandle cbh = vpi_register_cb(&cb_data);
+    TEST_CHECK_NZ(cbh);
+    return cbh;
+}
+
+static uint64_t user_id(p_cb_data cb_data) {
+    return reinterpret_cast<uint64_t>(cb_data->user_data);
+}
+
+static int late_callback(p_cb_data cb_data) {
+    ++late_calls;
+    // Registered when slow changed, must only see the changes after that
+    TEST_CHECK_NE(cb_data->value->value.integer, 1);
+    return 0;
+}
+
+static int slow_callback(p_cb_data cb_data) {
+    ++slow_calls;
+    if (cb_data->value->value.integer == 1) {
+        // Registering on the same signal while its callbacks are running
+        late_cb = register_cb("slow", late_callback, 0);
+        // Remove half of the callbacks on 'count', including ones still to be called
+        for (int i = 0; i < N_COUNT_CBS; i += 2) {
+            TEST_CHECK_EQ(vpi_remove_cb(count_cbs[i]), 1);
+            count_cbs[i] = nullptr;
+        }
+    }
+    return 0;
+}
+
+static int count_callback(p_cb_data cb_data) {
+    ++count_calls;
+    // Callbacks are called in registration order
+    const uint64_t id = user_id(cb_data);
+    TEST_CHECK(id, last_id, id > last_id);
+    last_id = id;
+    TEST_CHECK_EQ(cb_data->value->value.integer, (main_time + 1) / 2);
+    return 0;
+}
+
+static int wide_callback(p_cb_data cb_data) {
+    ++wide_calls;
+    return 0;
+}
+
+double sc_time_stamp() { return main_time; }
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+    topp->clk = 0;
+
+    register_cb("slow", slow_callback, 0);
+    for (int i = 0; i < N_COUNT_CBS; ++i) {
+        count_cbs.push_back(register_cb("count", count_callback, i + 1));
+    }
+    register_cb("wide", wide_callback, 0);
+    register_cb("wide", wide_callback, 0);
+
+    int count_changes = 0;
+    while (main_time < 100 && !contextp->gotFinish()) {
+        main_time += 1;
+        topp->clk = !topp->clk;
+        topp->eval();
+        if (topp->clk) ++count_changes;
+        last_id = 0;
+        VerilatedVpi::callValueCbs();
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    TEST_CHECK_EQ(slow_calls, 5);
+    TEST_CHECK_EQ(late_calls, 4);
+    TEST_CHECK_EQ(wide_calls, 2);
+    // 'slow' became 1 on the 4th change of 'count', its callback was called
+    // first and removed half of the 'count' callbacks
+    TEST_CHECK_EQ(count_calls, 3 * N_COUNT_CBS + (count_changes - 3) * N_COUNT_CBS / 2);
+
+    for (vpiHandle cbh : count_cbs) {
+        if (cbh) TEST_CHECK_EQ(vpi_remove_cb(cbh), 1);
+    }
+    TEST_CHECK_EQ(vpi_remove_cb(late_cb), 1);
+
+    topp->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  reg [31:0] count  /*verilator public_flat_rd */;
+  reg [7:0] slow  /*verilator public_flat_rd */;
+  reg [95:0] wide  /*verilator public_flat_rd */;
+
+  initial begin
+    count = 0;
+    slow = 0;
+    wide = 0;
+  end
+
+  always @(posedge clk) begin
+    count <= count + 1;
+    if (count % 4 == 3) slow <= slow + 1;
+    if (count == 5) wide[80] <= 1'b1;
+    if (count == 20) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
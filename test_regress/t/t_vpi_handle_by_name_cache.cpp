@@ -0,0 +1,105 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// Repeated vpi_handle_by_name lookups of the same names return equivalent,
+// independent handles.
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+unsigned main_time = 0;
+
+static int get_int(vpiHandle h) {
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    vpi_get_value(h, &v);
+    return v.value.integer;
+}
+
+static void check_name(const char* name, vpiHandle scope, const char* fullname, int value) {
+    vpiHandle h1 = vpi_handle_by_name(const_cast<PLI_BYTE8*>(name), scope);
+    vpiHandle h2 = vpi_handle_by_name(const_cast<PLI_BYTE8*>(name), scope);
+    TEST_CHECK_NZ(h1);
+    TEST_CHECK_NZ(h2);
+    if (!h1 || !h2) return;
+    // Each lookup gives its own handle, valid after the other is released
+    TEST_CHECK_NE(h1, h2);
+    TEST_CHECK_EQ(std::string{vpi_get_str(vpiFullName, h1)}, fullname);
+    vpi_release_handle(h1);
+    TEST_CHECK_EQ(std::string{vpi_get_str(vpiFullName, h2)}, fullname);
+    if (value >= 0) TEST_CHECK_EQ(get_int(h2), value);
+    vpi_release_handle(h2);
+}
+
+static void check_names() {
+    const int count = (main_time + 1) / 2;
+    check_name("t.count", nullptr, "t.count", count);
+    check_name("$root.t.count", nullptr, "t.count", count);
+    check_name("t.count[3:0]", nullptr, "t.count", count & 0xf);
+    check_name("t.mem[2]", nullptr, "t.mem[2]", 0x12);
+    check_name("t.u_sub", nullptr, "t.u_sub", -1);
+    check_name("t.u_sub.value", nullptr, "t.u_sub.value", 0x1234);
+    TestVpiHandle scope = VPI_HANDLE("");
+    TEST_CHECK_NZ(scope);
+    check_name("count", scope, "t.count", count);
+    check_name("u_sub.value", scope, "t.u_sub.value", 0x1234);
+    for (int i = 0; i < 2; ++i) {
+        TEST_CHECK_Z(vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.nonexistent"), nullptr));
+        TEST_CHECK_Z(vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.mem[4]"), nullptr));
+    }
+}
+
+double sc_time_stamp() { return main_time; }
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+    topp->clk = 0;
+
+    while (main_time < 100 && !contextp->gotFinish()) {
+        main_time += 1;
+        topp->clk = !topp->clk;
+        topp->eval();
+        check_names();
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    topp->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,37 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  reg [31:0] count  /*verilator public_flat_rw */;
+  reg [7:0] mem[0:3]  /*verilator public_flat_rw */;
+
+  sub u_sub ();
+
+  initial begin
+    count = 0;
+    mem[0] = 8'h10;
+    mem[1] = 8'h11;
+    mem[2] = 8'h12;
+    mem[3] = 8'h13;
+  end
+
+  always @(posedge clk) begin
+    count <= count + 1;
+    if (count == 10) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
+
+module sub;
+  reg [15:0] value  /*verilator public_flat_rw */;
+  initial value = 16'h1234;
+endmodule